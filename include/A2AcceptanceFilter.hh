@@ -0,0 +1,66 @@
+// Event pre-filter on a geometric acceptance map: directions from the
+// target center are classified once by tracing straight rays through the
+// constructed geometry to a sensitive detector volume
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2AcceptanceFilter_h
+#define A2AcceptanceFilter_h 1
+
+#include <vector>
+
+#include "G4ThreeVector.hh"
+
+class G4VPhysicalVolume;
+class G4Navigator;
+class A2FileGenerator;
+
+class A2AcceptanceFilter
+{
+
+public:
+    enum EFilterMode {
+        kOff,               // no filtering
+        kSkip,              // skip events outside the acceptance
+        kWeight             // keep a fraction of them with a weight
+    };
+
+protected:
+    EFilterMode fMode;                  // filter mode
+    G4double fKeepFraction;             // kept fraction of rejected events (weight mode)
+    G4int fNTheta;                      // number of polar-angle bins
+    G4int fNPhi;                        // number of azimuthal-angle bins
+    std::vector<G4bool> fMap;           // acceptance map [iTheta*fNPhi + iPhi]
+    G4ThreeVector fOrigin;              // origin of the rays
+    G4long fNEvents;                    // number of tested events
+    G4long fNOutside;                   // number of events outside the acceptance
+    G4long fNRejected;                  // number of rejected events
+
+    G4bool TraceRay(G4Navigator& nav, const G4ThreeVector& dir) const;
+    G4bool DecaysInFlight(const A2FileGenerator* gen, G4int p) const;
+    G4bool IsInside(const A2FileGenerator* gen) const;
+
+    static const G4double fgMaxDecayLength;
+
+public:
+    A2AcceptanceFilter();
+    virtual ~A2AcceptanceFilter() { }
+
+    void SetMode(EFilterMode m) { fMode = m; }
+    G4bool SetMode(const G4String& mode);
+    void SetKeepFraction(G4double f) { fKeepFraction = f; }
+    void SetNBins(G4int nTheta) { fNTheta = nTheta; fNPhi = 2*nTheta; fMap.clear(); }
+
+    G4bool IsActive() const { return fMode != kOff; }
+    G4bool IsBuilt() const { return !fMap.empty(); }
+    const char* GetModeName() const;
+    void Build(G4VPhysicalVolume* world, const G4ThreeVector& origin);
+    G4bool IsInAcceptance(const G4ThreeVector& dir) const;
+    G4bool Select(const A2FileGenerator* gen, G4double& weight);
+
+    G4long GetNEvents() const { return fNEvents; }
+    G4long GetNOutside() const { return fNOutside; }
+    G4long GetNRejected() const { return fNRejected; }
+};
+
+#endif
+
@@ -0,0 +1,39 @@
+// Sampling of discrete distributions in constant time using alias tables
+// (Walker/Vose alias method)
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2AliasSampler_h
+#define A2AliasSampler_h 1
+
+#include <vector>
+
+#include "G4Types.hh"
+
+class A2AliasSampler
+{
+
+protected:
+    std::vector<G4double> fProb;    // probability of keeping the bin
+    std::vector<G4int> fAlias;      // alias bin
+
+public:
+    A2AliasSampler() { }
+    virtual ~A2AliasSampler() { }
+
+    G4bool Init(const std::vector<G4double>& weights);
+
+    G4int GetN() const { return fProb.size(); }
+    G4bool IsEmpty() const { return fProb.empty(); }
+
+    G4int Sample(G4double u) const
+    {
+        // Return a bin for the uniform random number 'u' in [0,1).
+        G4double x = u * fProb.size();
+        G4int i = (G4int)x;
+        if (i >= (G4int)fProb.size()) i = fProb.size() - 1;
+        return x - i < fProb[i] ? i : fAlias[i];
+    }
+};
+
+#endif
+
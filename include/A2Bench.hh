@@ -0,0 +1,47 @@
+// Benchmark report of a run: event and step rates, peak memory and
+// output size, appended as one JSON line per run
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2Bench_h
+#define A2Bench_h 1
+
+#include <chrono>
+
+#include "globals.hh"
+
+class A2Bench
+{
+
+public:
+    typedef std::chrono::steady_clock Clock_t;
+
+protected:
+    G4String fFile;                     // JSON lines file
+    G4String fName;                     // name of the workload
+    Clock_t::time_point fCreated;       // creation time (program start)
+    Clock_t::time_point fStart;         // start of the run
+    G4double fStartup;                  // time until the start of the first run [s]
+    G4double fTime;                     // tracking time of the run [s]
+    G4long fNEvents;                    // number of events
+    G4long fNSteps;                     // number of steps
+    G4long fNTrackInfo;                 // number of created track information objects
+
+public:
+    A2Bench(const G4String& file, const G4String& macro);
+    virtual ~A2Bench() { }
+
+    void BeginOfRun();
+    void EndOfRun(G4int nEvents);
+    G4bool Write(const G4String& outFile) const;
+
+    void Step() { fNSteps++; }
+
+    const G4String& GetFile() const { return fFile; }
+    const G4String& GetName() const { return fName; }
+    G4double GetStartupTime() const { return fStartup; }
+
+    static G4double GetPeakRSS();
+};
+
+#endif
+
@@ -0,0 +1,54 @@
+// Geant4 biasing operator scaling the cross sections of selected physics
+// processes (e.g. rare hadronic channels) of selected primary particles
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2BiasingOperator_h
+#define A2BiasingOperator_h 1
+
+#include <map>
+#include <vector>
+
+#include "G4VBiasingOperator.hh"
+
+class G4BOptnChangeCrossSection;
+
+class A2BiasingOperator : public G4VBiasingOperator
+{
+
+protected:
+    struct A2XSBias_t {
+        G4String fParticle;         // particle name
+        G4String fProcess;          // process name ("all" for all processes)
+        G4double fFactor;           // cross-section scaling factor
+    };
+
+    std::vector<A2XSBias_t> fBias;  // configured biases
+    std::map<const G4BiasingProcessInterface*, G4BOptnChangeCrossSection*> fOperations;
+    std::map<const G4BiasingProcessInterface*, G4double> fFactors;
+
+    virtual G4VBiasingOperation* ProposeOccurenceBiasingOperation(const G4Track* track,
+                                                                  const G4BiasingProcessInterface* callingProcess);
+    virtual G4VBiasingOperation* ProposeFinalStateBiasingOperation(const G4Track*,
+                                                                   const G4BiasingProcessInterface*) { return 0; }
+    virtual G4VBiasingOperation* ProposeNonPhysicsBiasingOperation(const G4Track*,
+                                                                   const G4BiasingProcessInterface*) { return 0; }
+    virtual void OperationApplied(const G4BiasingProcessInterface* callingProcess,
+                                  G4BiasingAppliedCase biasingCase,
+                                  G4VBiasingOperation* occurenceOperationApplied,
+                                  G4double weightForOccurenceInteraction,
+                                  G4VBiasingOperation* finalStateOperationApplied,
+                                  const G4VParticleChange* particleChangeProduced);
+
+public:
+    A2BiasingOperator();
+    virtual ~A2BiasingOperator();
+
+    virtual void StartRun();
+
+    void AddBias(const G4String& particle, const G4String& process, G4double factor);
+    void AttachToAllVolumes();
+    std::vector<G4String> GetParticles() const;
+};
+
+#endif
+
@@ -0,0 +1,82 @@
+// Bounded blocking queue to pass data between a producer and a consumer thread
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2BoundedQueue_h
+#define A2BoundedQueue_h 1
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+#include "G4Types.hh"
+
+template <class T>
+class A2BoundedQueue
+{
+
+private:
+    std::deque<T> fQueue;               // queued items
+    size_t fCapacity;                   // maximum number of queued items
+    G4bool fClosed;                     // no more items will be pushed/popped
+    std::mutex fMutex;                  // queue mutex
+    std::condition_variable fNotFull;   // signalled when an item was popped
+    std::condition_variable fNotEmpty;  // signalled when an item was pushed
+
+public:
+    A2BoundedQueue(size_t capacity)
+        : fCapacity(capacity > 0 ? capacity : 1), fClosed(false) { }
+
+    G4bool Push(T& item)
+    {
+        // Move 'item' to the end of the queue, block while the queue is full.
+        // Return false if the queue was closed.
+
+        std::unique_lock<std::mutex> lock(fMutex);
+        while (fQueue.size() >= fCapacity && !fClosed)
+            fNotFull.wait(lock);
+        if (fClosed)
+            return false;
+        fQueue.push_back(std::move(item));
+        fNotEmpty.notify_one();
+        return true;
+    }
+
+    G4bool Pop(T& item)
+    {
+        // Move the first item of the queue to 'item', block while the queue
+        // is empty. Return false if the queue is empty and closed.
+
+        std::unique_lock<std::mutex> lock(fMutex);
+        while (fQueue.empty() && !fClosed)
+            fNotEmpty.wait(lock);
+        if (fQueue.empty())
+            return false;
+        item = std::move(fQueue.front());
+        fQueue.pop_front();
+        fNotFull.notify_one();
+        return true;
+    }
+
+    void Close()
+    {
+        // Close the queue and wake up all waiting threads. Items already
+        // queued can still be popped.
+
+        std::lock_guard<std::mutex> lock(fMutex);
+        fClosed = true;
+        fNotFull.notify_all();
+        fNotEmpty.notify_all();
+    }
+
+    void Clear()
+    {
+        // Remove all queued items.
+
+        std::lock_guard<std::mutex> lock(fMutex);
+        fQueue.clear();
+        fNotFull.notify_all();
+    }
+};
+
+#endif
+
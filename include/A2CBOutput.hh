@@ -87,6 +87,12 @@ protected:
   Float_t ftpiz[MAXSIZE_PIZZA]; //hit sector time
 
   Float_t fweight; // event weight
+  Int_t ftagch; // tagger channel of the beam photon
+
+  Float_t fcputime; // CPU time of the event [ms]
+  Long64_t fnsteps; // number of steps of the event
+  Int_t fnsec;      // number of secondaries of the event
+  Int_t fmaxstack;  // maximum stack depth of the event
 
   TLorentzVector** fGenLorentzVec;
   TLorentzVector* fBeamLorentzVec;
@@ -95,16 +101,25 @@ protected:
   G4int fCBCollID;
   G4int fTAPSCollID;
   G4bool fStorePrimaries;
+  G4bool fStoreEventStats;
+  G4bool fAttach;   //branches of an existing tree are continued
+
+  void AddBranch(const char* name,void* address,const char* leaflist,Int_t basket);
 
 public:
   void SetFile(TFile* f){fFile=f;fTree->SetDirectory(fFile);}
   TFile* GetFile(){return fFile;}
 
   void SetTree(TTree* t){fTree=t;}
+  void AttachTree(TTree* t);
   TTree* GetTree(){return fTree;}
  
   void SetBranches();
   void SetStorePrimaries(G4bool val) { fStorePrimaries = val; }
+  void SetStoreEventStats(G4bool val) { fStoreEventStats = val; }
+  G4bool IsStoreEventStats() const { return fStoreEventStats; }
+  void SetEventStats(Float_t cputime, Long64_t nsteps, Int_t nsec, Int_t maxstack)
+  { fcputime = cputime; fnsteps = nsteps; fnsec = nsec; fmaxstack = maxstack; }
   
   void WriteTree(){fTree->Write();}
   void WriteHit(G4HCofThisEvent* );
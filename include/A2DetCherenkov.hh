@@ -4,6 +4,8 @@
 
 #include "A2Detector.hh"
 
+class G4Region;
+
 class A2DetCherenkov : public A2Detector
 {
 public:
@@ -17,6 +19,7 @@ public:
 
   private:
   G4bool fIsCheckOverlap;
+  G4Region* fregionFrame;   //steel frame, allows larger cuts to be defined
 
   G4LogicalVolume *fAirBoxLogic;
   G4LogicalVolume *fAlBoxLogic;
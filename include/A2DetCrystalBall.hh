@@ -112,6 +112,7 @@ private:
 
   G4VisAttributes* fCrystVisAtt;
   G4Region* fregionCB;
+  G4Region* fregionCBPassive;   //passive material (tunnel, bottoms, skirts, rims)
 } ;
 
 #endif
@@ -37,6 +37,11 @@ class A2DetectorConstruction : public G4VUserDetectorConstruction
 
      void UpdateGeometry();
      void DefineMaterials();
+     void DefineTargetMaterials();
+     void CreateTarget();
+     G4String GetGeometryCacheBase();
+     G4bool ReadGeometryCache(const G4String& base);
+     void WriteGeometryCache(const G4String& base);
   void SetIsInteractive(G4int is){fIsInteractive=is;}
      
   //Set functions used by messenger class
@@ -50,7 +55,7 @@ class A2DetectorConstruction : public G4VUserDetectorConstruction
   G4int GetUseMWPC() const { return fUseMWPC; }
 
   void SetUseTarget(G4String use){fUseTarget=use;}
-  void SetTargetMaterial(G4String mat){fTargetMaterial=G4NistManager::Instance()->FindOrBuildMaterial(mat);}
+  void SetTargetMaterial(G4String mat);
   void SetDetectorSetup(G4String ds){fDetectorSetup=ds;}
   G4Material* GetTargetMaterial(){return fTargetMaterial;}
   void SetTargetLength(G4double zz){fTargetLength=zz;}
@@ -104,6 +109,7 @@ public:
   G4String fCBCrystGeometry;
   A2Target* fTarget;
   G4Material* fTargetMaterial;
+  G4bool fTargetMaterialsDefined; //cryo/polarized/solid target materials defined
   G4double fTargetLength;
   G4double fTargetRadius;
   G4double fTargetZ;
@@ -111,6 +117,7 @@ public:
   G4String fNameFileFieldMap;
 
   G4String fDetectorSetup; //Configuration macro name
+  G4String fGeometryKey; //key of the geometry cache entry
   A2DetectorMessenger* fDetMessenger;  //pointer to the Messenger
   
   //build detctor flags, should be set by DetectorSetup.mac 
@@ -7,6 +7,7 @@
 #include "TFile.h"
 #include "TTree.h"
 #include "TString.h"
+#include <ctime>
 
 #include "A2CBOutput.hh"
 
@@ -34,9 +35,19 @@ class A2EventAction : public G4UserEventAction
   void SetIsInteractive(G4int is){fIsInteractive=is;}
   void SetHitDrawOpt(G4String val){fHitDrawOpt=val;}
   void SetStorePrimaries(G4bool val) { fStorePrimaries = val; }
+  void SetStoreEventStats(G4bool val) { fStoreEventStats = val; }
+  void SetCheckpoint(G4int n) { fCheckpoint = n; }
+  G4int ReadCheckpoint();
+  G4int GetResumeInput() const { return fResumeInput; }
+  G4bool IsResumeComplete() const { return fResumeComplete; }
+  void CountStep() { fNSteps++; }
   void SetOutFileName(TString name){fOutFileName=name;}
+  const TString& GetOutFileName() const {return fOutFileName;}
+  TFile* GetOutFile() {return fOutFile;}
   G4int PrepareOutput();
+  void BeginOfRun();
   void CloseOutput();
+  void PrintInputSummary(G4int nEvents);
  private:
    A2RunAction*  frunAct;
    A2PrimaryGeneratorAction* fPGA;
@@ -48,10 +59,21 @@ class A2EventAction : public G4UserEventAction
    G4double fEventRate;
    G4int fReqEvents;
   TStopwatch* fTimer;
+  G4long fInputBytes0;
    //G4int     fDrawMode;
   G4String fHitDrawOpt;
   G4bool fOverwriteFile;
   G4bool fStorePrimaries;
+  G4bool fStoreEventStats;
+  G4long fNSteps;           //number of steps of the current event
+  std::clock_t fCPUStart;   //CPU time at the begin of the current event
+  G4int fCheckpoint;        //events between checkpoints (0 if disabled)
+  G4int fNextCheckpoint;    //number of events at the next checkpoint
+  G4bool fResume;           //resume the output from its last checkpoint
+  G4bool fResumeComplete;   //output to be resumed is already complete
+  Long64_t fResumeEntries;  //tree entries at the checkpoint (-1 if none)
+  G4int fResumeInput;       //input entry at the checkpoint
+  G4int fEventsDone0;       //events processed before the resumed run
   TString fInvokeCmd;
   TString fStartTime;
   TString fDuration;
@@ -67,6 +89,7 @@ class A2EventAction : public G4UserEventAction
   TString fOutFileName;
 
   static void FormatTimeSec(double seconds, TString& out);
+  void WriteCheckpoint(const G4Event* evt);
   void ReadDetectorSetup(const char* detSetup);
 };
 
@@ -30,6 +30,8 @@ class A2EventActionMessenger: public G4UImessenger
    G4UIcmdWithAString*   fHitDrawCmd;
     G4UIcmdWithAnInteger* fPrintCmd;    
     G4UIcmdWithABool* fStorePrimCmd;
+    G4UIcmdWithABool* fStoreStatsCmd;
+    G4UIcmdWithAnInteger* fCheckpointCmd;
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
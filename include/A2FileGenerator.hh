@@ -5,6 +5,7 @@
 #define A2FileGenerator_h 1
 
 #include <vector>
+#include <map>
 
 #include "G4ThreeVector.hh"
 
@@ -22,18 +23,31 @@ public:
         G4ThreeVector fX;           // vertex [mm]
         G4double fT;                // vertex time [ns]
         G4bool fIsTrack;            // tracking flag
+        G4int fPDG;                 // PDG code if definition is still to be resolved
         A2GenParticle_t() : fDef(0), fP(0, 0, 0), fE(0),
-                            fM(0), fX(0, 0, 0), fT(0), fIsTrack(false) { }
+                            fM(0), fX(0, 0, 0), fT(0), fIsTrack(false), fPDG(0) { }
         void SetCorrectMass(G4bool usePDG = false);
         void Print(const char* pre = "") const;
     };
 
+    struct A2GenEvent_t {
+        G4double fWeight;                   // event weight
+        A2GenParticle_t fBeam;              // beam particle
+        G4ThreeVector fVertex;              // primary vertex [mm]
+        std::vector<A2GenParticle_t> fPart; // list of particles
+        A2GenEvent_t() : fWeight(1), fVertex(0, 0, 0) { }
+    };
+
     enum EFileGenType {
         kNone,
         kMkin,
         kPluto,
         kPlutoCocktail,
-        kGiBUU
+        kGiBUU,
+        kHepMC,
+        kLHEF,
+        kBinary,
+        kReaction
     };
 
 protected:
@@ -44,6 +58,18 @@ protected:
     A2GenParticle_t fBeam;                  // beam particle
     G4ThreeVector fVertex;                  // primary vertex [mm]
     std::vector<A2GenParticle_t> fPart;     // list of particles
+    G4bool fGenVertex;                      // vertex is generated, not read
+    G4bool fVerbose;                        // print user info
+    G4bool fAsync;                          // decoding outside the main thread
+    std::map<G4int, G4ParticleDefinition*> fPartCache; // particle definitions
+
+    G4ParticleDefinition* FindParticle(G4int pdg);
+    void FillParticleCache();
+    void ResolveParticles();
+    virtual G4bool CompleteParticle(A2GenParticle_t& part);
+    void SaveEvent(A2GenEvent_t& ev) const;
+    void LoadEvent(A2GenEvent_t& ev);
+    void ShiftVertex(const G4ThreeVector& v);
 
 public:
     A2FileGenerator(const char* filename, EFileGenType type);
@@ -52,8 +78,10 @@ public:
     virtual G4bool Init() = 0;
     virtual G4bool ReadEvent(G4int event) = 0;
     virtual G4int GetMaxParticles() = 0;
+    virtual G4long GetBytesRead() const { return 0; }
 
     EFileGenType GetType() const { return fType; }
+    const char* GetTypeName() const;
     const G4String& GetFileName() const { return fFileName; }
     G4int GetNEvents() const { return fNEvents; }
     G4double GetWeight() const { return fWeight; }
@@ -73,9 +101,11 @@ public:
 
     void SetParticleIsTrack(G4int p, G4bool t = true);
     void SetWeight(G4double w) { fWeight = w; }
+    void SetVerbose(G4bool v) { fVerbose = v; }
 
     void GenerateVertexCylinder(G4double t_length, G4double t_center,
                                 G4double b_diam);
+    void SetGeneratedVertex(const G4ThreeVector& v) { fVertex = v; fGenVertex = true; }
 
     void Print() const;
 };
@@ -0,0 +1,67 @@
+// event generator reading a compact binary event stream, e.g. from a named
+// pipe or stdin written by an event generator running concurrently
+// Author: Dominik Werthmueller, 2026
+//
+// Stream format (native byte order, i.e. little-endian on x86):
+//   header   : char[4] "A2EV", uint32 version (1)
+//   per event: uint32 npart, float64 weight,
+//              int32 beam PDG, float64 beam px, py, pz, E [MeV],
+//              float64 vertex x, y, z [mm], t [ns],
+//              npart x (int32 PDG, float64 px, py, pz, E [MeV])
+
+#ifndef A2FileGeneratorBinary_h
+#define A2FileGeneratorBinary_h 1
+
+#include <atomic>
+#include <thread>
+
+#include "A2FileGeneratorStream.hh"
+#include "A2BoundedQueue.hh"
+
+class A2FileGeneratorBinary : public A2FileGeneratorStream
+{
+
+public:
+    struct A2BinEvent_t {
+        G4double fWeight;               // event weight
+        G4int fBeamPDG;                 // beam PDG code
+        G4double fBeam[4];              // beam 4-momentum [MeV]
+        G4double fVertex[4];            // vertex [mm] and time [ns]
+        std::vector<G4int> fPDG;        // particle PDG codes
+        std::vector<G4double> fMom;     // particle 4-momenta [MeV]
+    };
+
+    struct A2BinReader_t {
+        std::istream* fIn;                      // input stream
+        A2BoundedQueue<A2BinEvent_t> fQueue;    // buffered events
+        std::atomic<G4long> fBytes;             // bytes read
+        std::atomic<G4bool> fDone;              // reader thread has finished
+        G4String fError;                        // error of a corrupt record
+        A2BinReader_t(std::istream* in, G4int size)
+            : fIn(in), fQueue(size), fBytes(0), fDone(false) { }
+    };
+
+protected:
+    G4int fBufferSize;                          // number of buffered events
+    A2BinReader_t* fReader;                     // state shared with the reader thread
+    std::thread* fReaderThread;                 // stream reader thread
+
+    virtual G4bool ParseEvent();
+
+    static G4bool ReadData(A2BinReader_t* r, void* data, size_t size);
+    static G4bool ReadRecord(A2BinReader_t* r, A2BinEvent_t& ev);
+    static void ReaderLoop(A2BinReader_t* r);
+
+    static const G4int fgMaxStreamParticles;
+
+public:
+    A2FileGeneratorBinary(const char* filename);
+    virtual ~A2FileGeneratorBinary();
+
+    virtual G4bool Init();
+    virtual G4long GetBytesRead() const { return fReader ? fReader->fBytes.load() : 0; }
+
+    void SetBufferSize(G4int n) { fBufferSize = n; }
+};
+
+#endif
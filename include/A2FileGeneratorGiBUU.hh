@@ -22,6 +22,10 @@ protected:
     std::vector<G4double>* fReaderY;    // particle position
     std::vector<G4double>* fReaderZ;    // particle position
 
+    virtual G4bool ReadEntry(G4int entry);
+    virtual G4bool CompleteParticle(A2GenParticle_t& part);
+    virtual A2FileGeneratorTree* CreateReader() const;
+
     static const G4int fgMaxParticles;
 
 public:
@@ -29,7 +33,6 @@ public:
     virtual ~A2FileGeneratorGiBUU();
 
     virtual G4bool Init();
-    virtual G4bool ReadEvent(G4int event);
     virtual G4int GetMaxParticles();
 };
 
@@ -0,0 +1,26 @@
+// event generator reading HepMC3 ASCII event-files
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2FileGeneratorHepMC_h
+#define A2FileGeneratorHepMC_h 1
+
+#include "A2FileGeneratorStream.hh"
+
+class A2FileGeneratorHepMC : public A2FileGeneratorStream
+{
+
+protected:
+    G4double fMomUnit;      // momentum unit of the input
+    G4double fLengthUnit;   // length unit of the input
+
+    virtual G4bool ParseEvent();
+
+public:
+    A2FileGeneratorHepMC(const char* filename);
+    virtual ~A2FileGeneratorHepMC();
+
+    virtual G4bool Init();
+};
+
+#endif
+
@@ -0,0 +1,23 @@
+// event generator reading Les Houches event-files (LHEF)
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2FileGeneratorLHEF_h
+#define A2FileGeneratorLHEF_h 1
+
+#include "A2FileGeneratorStream.hh"
+
+class A2FileGeneratorLHEF : public A2FileGeneratorStream
+{
+
+protected:
+    virtual G4bool ParseEvent();
+
+public:
+    A2FileGeneratorLHEF(const char* filename);
+    virtual ~A2FileGeneratorLHEF();
+
+    virtual G4bool Init();
+};
+
+#endif
+
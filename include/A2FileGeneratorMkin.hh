@@ -18,6 +18,9 @@ protected:
     Float_t** fPartPBr;     //[fNPart] particle 4-momenta
     Float_t** fPartVBr;     //[fNPart] particle vertices
 
+    virtual G4bool ReadEntry(G4int entry);
+    virtual A2FileGeneratorTree* CreateReader() const;
+
     static const G4int fgMaxParticles;
 
 public:
@@ -25,7 +28,6 @@ public:
     virtual ~A2FileGeneratorMkin();
 
     virtual G4bool Init();
-    virtual G4bool ReadEvent(G4int event);
     virtual G4int GetMaxParticles();
 };
 
@@ -24,6 +24,10 @@ protected:
 
     G4ParticleDefinition* PlutoToG4(Int_t id);
 
+    virtual G4bool ReadEntry(G4int entry);
+    virtual G4bool CompleteParticle(A2GenParticle_t& part);
+    virtual A2FileGeneratorTree* CreateReader() const;
+
     static const G4int fgMaxParticles;
     static const G4int fgPlutoG4Conversion[70];
 
@@ -32,7 +36,6 @@ public:
     virtual ~A2FileGeneratorPluto();
 
     virtual G4bool Init();
-    virtual G4bool ReadEvent(G4int event);
     virtual G4int GetMaxParticles();
 };
 
@@ -0,0 +1,46 @@
+// abstract event generator reading text event-files sequentially
+// (regular files, named pipes or stdin)
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2FileGeneratorStream_h
+#define A2FileGeneratorStream_h 1
+
+#include <iosfwd>
+#include <string>
+
+#include "A2FileGenerator.hh"
+
+class A2FileGeneratorStream : public A2FileGenerator
+{
+
+protected:
+    std::istream* fStream;          // input stream
+    std::ifstream* fFile;           // input file (0 if reading from stdin)
+    G4long fBytesRead;              // number of bytes read
+    std::string fLine;              // current line
+    G4bool fPushedBack;             // current line will be returned again
+    G4int fMaxPart;                 // maximum number of particles per event
+    G4bool fWarnMaxPart;            // particle limit warning was shown
+
+    G4bool ReadLine();
+    void PushBack() { fPushedBack = true; }
+    void ParseError(const char* what);
+    G4bool AddParticle(G4int pdg, const G4ThreeVector& p, G4double e,
+                       const G4ThreeVector& x, G4double t);
+    void SetBeam(G4int pdg, const G4ThreeVector& p, G4double e);
+    virtual G4bool ParseEvent() = 0;
+
+    static const G4int fgMaxParticles;
+
+public:
+    A2FileGeneratorStream(const char* filename, EFileGenType type);
+    virtual ~A2FileGeneratorStream();
+
+    virtual G4bool Init();
+    virtual G4bool ReadEvent(G4int event);
+    virtual G4int GetMaxParticles() { return fgMaxParticles; }
+    virtual G4long GetBytesRead() const { return fBytesRead; }
+};
+
+#endif
+
@@ -4,19 +4,46 @@
 #ifndef A2FileGeneratorTree_h
 #define A2FileGeneratorTree_h 1
 
+#include <atomic>
+#include <deque>
+#include <thread>
+
 #include "A2FileGenerator.hh"
 
 class TFile;
 class TTree;
+template <class T> class A2BoundedQueue;
 
 class A2FileGeneratorTree : public A2FileGenerator
 {
 
 protected:
-    TFile* fFile;           // ROOT input file
-    TTree* fTree;           // input tree
+    TFile* fFile;                       // ROOT input file
+    TTree* fTree;                       // input tree
+    G4int fCacheSize;                   // size of the tree cache [MB]
+    G4bool fCacheLearning;              // cache learning phase still active
+    G4bool fBranchesDisabled;           // only linked branches are read
+    G4int fReadAhead;                   // number of events to read ahead
+    std::deque<A2GenEvent_t> fStaged;   // staging buffer of decoded events
+    G4int fStagedEntry;                 // tree entry of first staged event
+    G4int fPrefetch;                    // depth of the prefetch queue
+    A2FileGeneratorTree* fPrefetchReader;           // reader of the prefetch thread
+    A2BoundedQueue<A2GenEvent_t>* fPrefetchQueue;   // queue of prefetched events
+    std::thread* fPrefetchThread;       // prefetch thread
+    G4int fPrefetchEntry;               // tree entry of next prefetched event
+    std::atomic<G4long> fAsyncBytesRead;    // bytes read in the prefetch thread
 
+    void InitCache();
+    void StopCacheLearning();
     G4bool LinkBranch(const char* bname, void* addr, G4bool verbose = true);
+    G4bool FillStaging(G4int entry);
+    G4bool StartPrefetch(G4int entry);
+    void StopPrefetch();
+    virtual G4bool ReadEntry(G4int entry);
+    virtual A2FileGeneratorTree* CreateReader() const { return 0; }
+
+    static void PrefetchLoop(A2FileGeneratorTree* reader,
+                             A2BoundedQueue<A2GenEvent_t>* queue, G4int entry);
 
 public:
     A2FileGeneratorTree(const char* filename, EFileGenType type,
@@ -25,6 +52,13 @@ public:
 
     virtual G4bool Init();
     virtual G4bool ReadEvent(G4int event);
+    virtual G4long GetBytesRead() const;
+
+    void SetCacheSize(G4int size) { fCacheSize = size; }
+    void SetReadAhead(G4int n) { fReadAhead = n; }
+    void SetPrefetch(G4int depth) { fPrefetch = depth; }
+
+    static void EnableThreadSupport();
 };
 
 #endif
@@ -0,0 +1,81 @@
+// Exporter of live run metrics in the Prometheus text format to a file
+// (atomically replaced) or a Unix socket for the monitoring of batch jobs
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2Metrics_h
+#define A2Metrics_h 1
+
+#include <deque>
+#include <chrono>
+
+#include "globals.hh"
+
+class A2MetricsMessenger;
+class TFile;
+
+class A2Metrics
+{
+
+public:
+    typedef std::chrono::steady_clock Clock_t;
+
+    // sample of the counters for the rates over sliding windows
+    struct A2MetricsSample_t {
+        Clock_t::time_point fTime;      // time of the sample
+        G4long fEvents;                 // number of events
+        G4long fSteps;                  // number of steps
+    };
+
+    static const G4int kNWindow = 3;    // number of sliding windows
+    static const G4int kWindow[kNWindow];   // sliding windows [s]
+
+protected:
+    G4String fFile;                     // metrics file (empty if none)
+    G4String fSocket;                   // Unix socket (empty if none)
+    G4double fInterval;                 // update interval [s]
+    G4String fJob;                      // job label
+
+    // run counters
+    G4long fEvents;                     // number of events
+    G4long fSteps;                      // number of steps
+    G4long fRequested;                  // requested events (0 if unknown)
+    Clock_t::time_point fStart;         // start of the run
+    Clock_t::time_point fLast;          // time of the last snapshot
+    std::deque<A2MetricsSample_t> fSamples; // samples within the longest window
+    G4bool fSocketWarned;               // socket error already reported
+
+    A2MetricsMessenger* fMessenger;     // messenger
+
+    G4String Format(const TFile* out, G4bool finished) const;
+    G4bool WriteFile(const G4String& text) const;
+    G4bool WriteSocket(const G4String& text);
+    void Snapshot(const TFile* out, G4bool finished);
+
+public:
+    A2Metrics();
+    virtual ~A2Metrics();
+
+    void SetFile(const G4String& f) { fFile = f; }
+    void SetSocket(const G4String& s) { fSocket = s; }
+    void SetInterval(G4double t) { fInterval = t; }
+    void SetJob(const G4String& j) { fJob = j; }
+    G4bool IsEnabled() const { return !fFile.empty() || !fSocket.empty(); }
+
+    void BeginOfRun(G4long requested);
+    void EndOfRun(const TFile* out) { Snapshot(out, true); }
+
+    void EndOfEvent(G4long steps, const TFile* out)
+    {
+        // count the event, write a snapshot once per interval
+        fEvents++;
+        fSteps += steps;
+        Clock_t::time_point now = Clock_t::now();
+        if (std::chrono::duration<G4double>(now - fLast).count() >= fInterval)
+            Snapshot(out, false);
+    }
+
+    static G4double GetRSS();
+};
+
+#endif
+
@@ -0,0 +1,30 @@
+#ifndef A2MetricsMessenger_h
+#define A2MetricsMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class A2Metrics;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+class G4UIcmdWithADoubleAndUnit;
+
+class A2MetricsMessenger: public G4UImessenger
+{
+  public:
+    A2MetricsMessenger(A2Metrics*);
+   ~A2MetricsMessenger();
+
+    void SetNewValue(G4UIcommand*, G4String);
+
+  private:
+    A2Metrics*                   fMetrics;
+    G4UIdirectory*               fMetricsDir;
+    G4UIcmdWithAString*          fFileCmd;
+    G4UIcmdWithAString*          fSocketCmd;
+    G4UIcmdWithADoubleAndUnit*   fIntervalCmd;
+    G4UIcmdWithAString*          fJobCmd;
+};
+
+#endif
+
@@ -77,6 +77,9 @@ private:
   G4UIcmdWithoutParameter*   fListCmd;  
   G4UIcmdWithADoubleAndUnit* fRegCutCmd;
   G4UIcmdWithAString*        fRegCmd;
+  G4UIcmdWithAString*        fBiasXSCmd;
+  G4UIcmdWithAString*        fCutTableCmd;
+  G4UIcmdWithAString*        fKillCmd;
   G4UIdirectory* fPhysDir;
 };
 
@@ -48,6 +48,9 @@
 
 class G4VPhysicsConstructor;
 class A2PhysicsListMessenger;
+class A2BiasingOperator;
+class G4GenericBiasingPhysics;
+class A2RegionCuts;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -68,9 +71,14 @@ public:
   void SetCutForPositron(G4double);
   void SetCutForProton(G4double);
   void SetCutForRegion(G4String reg,G4double cut);
+  void SetRegionCut(const G4String& reg, G4double cut, G4double minEkine);
+  G4bool LoadCutTable(const G4String& fileName);
+  void SetKillThreshold(const G4String& reg, const G4String& particle, G4double ekin);
         
   void AddPhysicsList(const G4String& name);
+  void BiasCrossSection(const G4String& particle, const G4String& process, G4double factor);
   void List();
+  G4String GetPhysicsName() const;
   
 private:
 
@@ -85,10 +93,16 @@ private:
 
   G4VPhysicsConstructor*  fEmPhysicsList;
   G4VPhysicsConstructor*  fParticleList;
+  G4VPhysicsConstructor*  fStepLimiter;
   std::vector<G4VPhysicsConstructor*>  fHadronPhys;
     
   A2PhysicsListMessenger* fMessenger;
 
+  G4GenericBiasingPhysics* fBiasingPhysics;
+  A2BiasingOperator* fBiasingOperator;
+
+  A2RegionCuts* fRegionCuts;
+
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,50 @@
+// Importance sampling of generated events: events are kept with a
+// probability given by the importance of the polar-angle regions hit by
+// their tracked particles and weighted with the inverse probability
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2PrimaryBiasing_h
+#define A2PrimaryBiasing_h 1
+
+#include <vector>
+
+#include "globals.hh"
+
+class A2FileGenerator;
+class A2PrimaryBiasingMessenger;
+
+class A2PrimaryBiasing
+{
+
+protected:
+    struct A2ThetaRegion_t {
+        G4double fThetaMin;         // minimum polar angle [rad]
+        G4double fThetaMax;         // maximum polar angle [rad]
+        G4double fImportance;       // importance
+    };
+
+    std::vector<A2ThetaRegion_t> fRegions;  // importance regions
+    G4double fMaxImportance;                // maximum importance
+    G4long fNEvents;                        // number of tested events
+    G4long fNRejected;                      // number of rejected events
+    A2PrimaryBiasingMessenger* fMessenger;  // messenger
+
+public:
+    A2PrimaryBiasing();
+    virtual ~A2PrimaryBiasing();
+
+    void AddThetaRegion(G4double thetaMin, G4double thetaMax, G4double importance);
+    void Clear();
+
+    G4bool IsActive() const { return !fRegions.empty(); }
+    G4double GetImportance(const A2FileGenerator* gen) const;
+    G4double GetKeepProbability(const A2FileGenerator* gen) const
+    { return GetImportance(gen) / fMaxImportance; }
+    G4bool Select(const A2FileGenerator* gen, G4double& weight);
+
+    G4long GetNEvents() const { return fNEvents; }
+    G4long GetNRejected() const { return fNRejected; }
+};
+
+#endif
+
@@ -0,0 +1,28 @@
+#ifndef A2PrimaryBiasingMessenger_h
+#define A2PrimaryBiasingMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class A2PrimaryBiasing;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class A2PrimaryBiasingMessenger: public G4UImessenger
+{
+  public:
+    A2PrimaryBiasingMessenger(A2PrimaryBiasing*);
+   ~A2PrimaryBiasingMessenger();
+
+    void SetNewValue(G4UIcommand*, G4String);
+
+  private:
+    A2PrimaryBiasing*            fBiasing;
+    G4UIdirectory*               fBiasDir;
+    G4UIcmdWithAString*          fThetaRegionCmd;
+    G4UIcmdWithoutParameter*     fClearCmd;
+};
+
+#endif
+
@@ -13,6 +13,11 @@ class G4Event;
 class A2PrimaryGeneratorMessenger;
 class A2DetectorConstruction;
 class A2FileGenerator;
+class A2ReactionGenerator;
+class A2TaggedBeam;
+class A2VertexSampler;
+class A2PrimaryBiasing;
+class A2AcceptanceFilter;
 
 //Event generator mode
 enum { EPGA_g4, EPGA_phase_space, EPGA_FILE, EPGA_Overlap};
@@ -28,6 +33,12 @@ public:
 
   void SetUpFileInput();
   void SetInputFile(TString filename){fInFileName=filename;};
+  void SetInputCacheSize(G4int size){fInputCacheSize=size;}
+  void SetInputReadAhead(G4int n){fInputReadAhead=n;}
+  void SetInputPrefetch(G4int n);
+  void SetTaggerFile(TString filename);
+  void SetBeamSpotHist(G4String spec);
+  void SetTargetProfileHist(G4String spec);
   void SetNParticlesToBeTracked(Int_t n){
     fNToBeTracked=n;
     fTrackThis=new Int_t[n];
@@ -52,20 +63,38 @@ public:
   TLorentzVector* GetBeamLorentzVec(){return fBeamLorentzVec;}
   Float_t* GetVertex(){return fGenPosition;}
   Int_t* GetGenPartType(){return fGenPartType;}
+  A2TaggedBeam* GetTaggedBeam(){return fTaggedBeam;}
+  Int_t GetTaggerChannel(){return fTaggerChannel;}
+  A2PrimaryBiasing* GetBiasing(){return fBiasing;}
+  A2AcceptanceFilter* GetAcceptanceFilter(){return fAcceptance;}
+  G4double GetEventWeight(){return fEventWeight;}
+  void MultiplyEventWeight(G4double w){fEventWeight*=w;}
 
   void SetDetCon(A2DetectorConstruction* det){fDetCon=det;}
+  void SetDryRun(G4bool dry){fDryRun=dry;}
+  G4bool IsDryRun(){return fDryRun;}
 
 private:
   G4ParticleGun*  fParticleGun;    //pointer to particle gun
   A2PrimaryGeneratorMessenger* fGunMessenger; //messenger of this class
   A2DetectorConstruction* fDetCon;   //pointer to the detector volumes
   TString fInFileName;  //Name of input file
+  G4int fInputCacheSize;  //Size of the input tree cache [MB]
+  G4int fInputReadAhead;  //Number of input events to read ahead
+  G4int fInputPrefetch;   //Depth of the input prefetch queue
   Int_t fNGenParticles;     //Number of particles in ntuple
   Int_t fNGenMaxParticles;     //Maximum number of particles in ntuple
   Float_t fGenPosition[3]; //vertex position from ntuple, can't be double!
   TLorentzVector ** fGenLorentzVec;    //4 vector components from the ntuple branches converted into a ROOT lorentz vector
   TLorentzVector* fBeamLorentzVec; //For the beam or nonntuple input
   A2FileGenerator* fFileGen;    // pointer to input file generator
+  A2ReactionGenerator* fReactionGen;    // built-in reaction generator (until used)
+  A2TaggedBeam* fTaggedBeam;    // tagged photon beam
+  Int_t fTaggerChannel;    //tagger channel of the beam photon (-1 if none)
+  A2VertexSampler* fVertexSampler;    // measured beam-spot/target-profile sampler
+  A2PrimaryBiasing* fBiasing;    // importance sampling of generated events
+  A2AcceptanceFilter* fAcceptance;    // geometric acceptance pre-filter
+  G4double fEventWeight;    //importance weight of the current event
 
   Int_t *fGenPartType;        //Array of G3 particle types
   Int_t *fTrackThis;         //Array carrying the index of particles to be tracked
@@ -74,14 +103,19 @@ private:
   Int_t fNevent;          //event number for the ROOT tree
 
   G4int fMode;    //select events via standard, phase space or ROOT input
+  G4bool fDryRun; //generate events only, primaries are not tracked
 public:
   void SetMode(G4int mode);
   G4int GetMode(){return fMode;}
+  const char* GetModeName();
   A2FileGenerator* GetFileGen() const { return fFileGen; }
+  Int_t GetInputEntry(){return fMode==EPGA_FILE ? fNevent-1 : -1;}  //input entry of the current event
+  void SetInputEntry(G4int entry);
   //for phase space generator
 private:
   void PhaseSpaceGenerator(G4Event* anEvent);
   void OverlapGenerator(G4Event* anEvent);
+  G4ThreeVector SampleBeamVertex();
   G4float fTmin;       //Min phase spce kinetic energy
   G4float fTmax;       //Max phase space kinetic energy
   G4float fThetamin;       //Min phase spce angle
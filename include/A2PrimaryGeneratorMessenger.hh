@@ -30,6 +30,15 @@ class A2PrimaryGeneratorMessenger: public G4UImessenger
  
   G4UIcmdWithAString* SetInputCmd;
   G4UIcmdWithAString* SetInput2Cmd;
+  G4UIcmdWithAnInteger* SetInputCacheCmd;
+  G4UIcmdWithAnInteger* SetInputReadAheadCmd;
+  G4UIcmdWithAnInteger* SetInputPrefetchCmd;
+  G4UIcmdWithAString* SetTaggerFileCmd;
+  G4UIcmdWithAString* SetBeamSpotHistCmd;
+  G4UIcmdWithAString* SetTargetProfileHistCmd;
+  G4UIcmdWithAString* SetAcceptanceFilterCmd;
+  G4UIcmdWithADouble* SetAcceptanceKeepCmd;
+  G4UIcmdWithAnInteger* SetAcceptanceBinsCmd;
   G4UIcmdWithAnInteger* SetNTrackCmd;
   G4UIcmdWithAnInteger* SetTrackCmd;
   G4UIcmdWithAnInteger* SetModeCmd;
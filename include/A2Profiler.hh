@@ -0,0 +1,106 @@
+// Opt-in profiler of the stepping hot path: step counts, wall time and
+// deposited energy per logical volume, region and particle type
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2Profiler_h
+#define A2Profiler_h 1
+
+#include <map>
+#include <chrono>
+
+#include "globals.hh"
+#include "G4Step.hh"
+
+class G4LogicalVolume;
+class G4ParticleDefinition;
+class A2ProfilerMessenger;
+class TFile;
+
+class A2Profiler
+{
+
+public:
+    struct A2ProfEntry_t {
+        G4long fSteps;          // number of steps
+        G4long fTracks;         // number of tracks
+        G4double fTime;         // wall time [s]
+        G4double fEdep;         // deposited energy [MeV]
+        A2ProfEntry_t() : fSteps(0), fTracks(0), fTime(0), fEdep(0) { }
+    };
+
+    typedef std::chrono::steady_clock Clock_t;
+
+protected:
+    G4bool fEnabled;                    // profiling enabled
+    G4String fJSONFile;                 // JSON summary file (empty if none)
+    G4int fNPrint;                      // number of printed volumes
+    Clock_t::time_point fLast;          // time of the last step/track start
+
+    // counters (per thread, the run manager is sequential)
+    std::map<const G4LogicalVolume*, A2ProfEntry_t> fVolumes;
+    std::map<const G4ParticleDefinition*, A2ProfEntry_t> fParticles;
+    std::map<G4String, A2ProfEntry_t> fRegions;     // filled at end of run
+    const G4LogicalVolume* fLastVol;    // volume of the last step
+    A2ProfEntry_t* fLastVolEntry;       // entry of the last volume
+    const G4ParticleDefinition* fLastPart;  // particle of the last step
+    A2ProfEntry_t* fLastPartEntry;      // entry of the last particle
+
+    A2ProfilerMessenger* fMessenger;    // messenger
+
+    void FillRegions();
+    void Print() const;
+    G4bool WriteJSON() const;
+
+public:
+    A2Profiler();
+    virtual ~A2Profiler();
+
+    void SetEnabled(G4bool e) { fEnabled = e; }
+    void SetJSONFile(const G4String& f) { fJSONFile = f; }
+    void SetNPrint(G4int n) { fNPrint = n; }
+    G4bool IsEnabled() const { return fEnabled; }
+
+    void BeginOfRun();
+    void EndOfRun();
+    void WriteTree(TFile* f) const;
+
+    void StartTrack(const G4ParticleDefinition* def)
+    {
+        // count the track, the time until its first step is its own
+        fParticles[def].fTracks++;
+        fLast = Clock_t::now();
+    }
+
+    void Step(const G4Step* step)
+    {
+        // attribute the time since the last step to this step
+        Clock_t::time_point now = Clock_t::now();
+        G4double dt = std::chrono::duration<G4double>(now - fLast).count();
+        fLast = now;
+
+        // volume entry (cached for consecutive steps in the same volume)
+        const G4LogicalVolume* vol = step->GetPreStepPoint()->GetPhysicalVolume()->GetLogicalVolume();
+        if (vol != fLastVol)
+        {
+            fLastVol = vol;
+            fLastVolEntry = &fVolumes[vol];
+        }
+        const G4ParticleDefinition* part = step->GetTrack()->GetDefinition();
+        if (part != fLastPart)
+        {
+            fLastPart = part;
+            fLastPartEntry = &fParticles[part];
+        }
+
+        G4double edep = step->GetTotalEnergyDeposit();
+        fLastVolEntry->fSteps++;
+        fLastVolEntry->fTime += dt;
+        fLastVolEntry->fEdep += edep;
+        fLastPartEntry->fSteps++;
+        fLastPartEntry->fTime += dt;
+        fLastPartEntry->fEdep += edep;
+    }
+};
+
+#endif
+
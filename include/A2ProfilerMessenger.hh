@@ -0,0 +1,30 @@
+#ifndef A2ProfilerMessenger_h
+#define A2ProfilerMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class A2Profiler;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+
+class A2ProfilerMessenger: public G4UImessenger
+{
+  public:
+    A2ProfilerMessenger(A2Profiler*);
+   ~A2ProfilerMessenger();
+
+    void SetNewValue(G4UIcommand*, G4String);
+
+  private:
+    A2Profiler*                  fProfiler;
+    G4UIdirectory*               fProfDir;
+    G4UIcmdWithABool*            fEnableCmd;
+    G4UIcmdWithAString*          fJSONCmd;
+    G4UIcmdWithAnInteger*        fPrintCmd;
+};
+
+#endif
+
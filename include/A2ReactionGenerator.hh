@@ -0,0 +1,103 @@
+// Built-in reaction event generator: photon beam on a target at rest,
+// N-body phase-space final state and phase-space decay chains.
+// Events are generated in batches with kinematics stored as arrays.
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2ReactionGenerator_h
+#define A2ReactionGenerator_h 1
+
+#include "A2FileGenerator.hh"
+
+class A2ReactionGeneratorMessenger;
+class A2TaggedBeam;
+
+class A2ReactionGenerator : public A2FileGenerator
+{
+
+public:
+    enum EBeamSpectrum {
+        kFlat,              // flat in energy
+        kBrems              // bremsstrahlung-like 1/E
+    };
+
+protected:
+    struct A2Decay_t {
+        G4String fParent;                   // name of the decaying particle
+        std::vector<G4String> fProducts;    // names of the decay products
+    };
+
+    struct A2Stage_t {
+        G4int fParent;                      // parent slot (-1 for initial state)
+        G4int fFirst;                       // first product slot
+        G4int fN;                           // number of products
+    };
+
+    // configuration
+    G4String fTargetName;                   // target particle name
+    std::vector<G4String> fFinalState;      // final-state particle names
+    std::vector<A2Decay_t> fDecays;         // decay definitions
+    G4double fBeamEMin;                     // minimum beam energy [MeV]
+    G4double fBeamEMax;                     // maximum beam energy [MeV]
+    EBeamSpectrum fBeamSpectrum;            // beam energy spectrum
+    G4bool fWeighted;                       // produce weighted events
+    G4int fBatchSize;                       // number of events per batch
+    const A2TaggedBeam* fTaggedBeam;        // tagged beam (0 if not used)
+
+    // reaction tree
+    G4double fTargetMass;                   // target mass [MeV]
+    std::vector<G4ParticleDefinition*> fSlotDef;    // particle of each slot
+    std::vector<G4double> fSlotMass;        // mass of each slot [MeV]
+    std::vector<G4bool> fSlotStable;        // slot is a final particle
+    std::vector<A2Stage_t> fStages;         // phase-space stages
+
+    // batch data (index [slot*fBatchSize + event])
+    std::vector<G4double> fPx;              // x-momenta [MeV]
+    std::vector<G4double> fPy;              // y-momenta [MeV]
+    std::vector<G4double> fPz;              // z-momenta [MeV]
+    std::vector<G4double> fE;               // energies [MeV]
+    std::vector<G4double> fBeamE;           // beam energies [MeV]
+    std::vector<G4int> fBeamCh;             // beam tagger channels
+    std::vector<G4double> fBatchWeight;     // event weights
+    std::vector<G4double> fRnd;             // random numbers
+    std::vector<G4double> fInvMass;         // intermediate invariant masses [MeV]
+    std::vector<G4double> fPd;              // intermediate momenta [MeV]
+    G4int fBatchPos;                        // next event in batch
+    G4int fTaggerChannel;                   // tagger channel of current event
+    G4long fNGenerated;                     // number of generated events
+    G4long fNAccepted;                      // number of accepted events
+
+    A2ReactionGeneratorMessenger* fMessenger;   // messenger
+
+    G4ParticleDefinition* FindParticleByName(const G4String& name) const;
+    G4double SampleBeamEnergy(G4double u) const;
+    void GenerateBatch();
+    void GenerateStage(const A2Stage_t& stage);
+
+    static G4double PDK(G4double a, G4double b, G4double c);
+
+public:
+    A2ReactionGenerator();
+    virtual ~A2ReactionGenerator();
+
+    virtual G4bool Init();
+    virtual G4bool ReadEvent(G4int event);
+    virtual G4int GetMaxParticles() { return fPart.size(); }
+
+    G4bool IsDefined() const { return !fFinalState.empty(); }
+    G4long GetNGenerated() const { return fNGenerated; }
+    G4long GetNAccepted() const { return fNAccepted; }
+    G4int GetTaggerChannel() const { return fTaggerChannel; }
+
+    void SetTarget(const G4String& name) { fTargetName = name; }
+    void SetFinalState(const G4String& names);
+    void AddDecay(const G4String& names);
+    void SetBeamEnergyMin(G4double e) { fBeamEMin = e; }
+    void SetBeamEnergyMax(G4double e) { fBeamEMax = e; }
+    void SetBeamSpectrum(EBeamSpectrum s) { fBeamSpectrum = s; }
+    void SetWeighted(G4bool w) { fWeighted = w; }
+    void SetBatchSize(G4int n) { fBatchSize = n; }
+    void SetTaggedBeam(const A2TaggedBeam* beam) { fTaggedBeam = beam; }
+};
+
+#endif
+
@@ -0,0 +1,36 @@
+#ifndef A2ReactionGeneratorMessenger_h
+#define A2ReactionGeneratorMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class A2ReactionGenerator;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithABool;
+
+class A2ReactionGeneratorMessenger: public G4UImessenger
+{
+  public:
+    A2ReactionGeneratorMessenger(A2ReactionGenerator*);
+   ~A2ReactionGeneratorMessenger();
+
+    void SetNewValue(G4UIcommand*, G4String);
+
+  private:
+    A2ReactionGenerator*         fReaction;
+    G4UIdirectory*               fReactionDir;
+    G4UIcmdWithAString*          fTargetCmd;
+    G4UIcmdWithAString*          fFinalStateCmd;
+    G4UIcmdWithAString*          fDecayCmd;
+    G4UIcmdWithADoubleAndUnit*   fBeamEMinCmd;
+    G4UIcmdWithADoubleAndUnit*   fBeamEMaxCmd;
+    G4UIcmdWithAString*          fBeamSpectrumCmd;
+    G4UIcmdWithABool*            fWeightedCmd;
+    G4UIcmdWithAnInteger*        fBatchSizeCmd;
+};
+
+#endif
+
@@ -0,0 +1,56 @@
+// Production cuts, energy thresholds and kill thresholds per region, kept
+// until the regions are constructed and shared by all physics list versions
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2RegionCuts_h
+#define A2RegionCuts_h 1
+
+#include <vector>
+
+#include "globals.hh"
+
+class G4Region;
+class G4ParticleDefinition;
+class A2UserLimits;
+
+class A2RegionCuts
+{
+
+protected:
+    struct A2RegionCut_t {
+        G4String fRegion;       // region name
+        G4double fCut;          // production cut
+        G4double fMinEkine;     // user-limit kinetic energy threshold (0=off)
+    };
+
+    struct A2KillThreshold_t {
+        G4String fRegion;       // region name
+        G4String fParticle;     // particle name
+        G4double fEkin;         // kinetic energy threshold
+    };
+
+    std::vector<A2RegionCut_t> fCuts;               // production cuts
+    std::vector<A2KillThreshold_t> fKillThresholds; // kill thresholds
+    G4bool fLimiterActive;                          // user limits are applied
+    G4int fVerbose;                                 // verbosity level
+
+    void ApplyRegionCut(size_t i);
+    void ApplyKillThreshold(size_t i);
+    G4bool HasSpecialCuts(G4ParticleDefinition* def);
+    A2UserLimits* GetRegionLimits(G4Region* region);
+
+public:
+    A2RegionCuts();
+    virtual ~A2RegionCuts() { }
+
+    void SetRegionCut(const G4String& reg, G4double cut, G4double minEkine);
+    void SetKillThreshold(const G4String& reg, const G4String& particle, G4double ekin);
+    G4bool LoadCutTable(const G4String& fileName);
+    void Apply();
+
+    G4bool UsesUserLimits() const;
+    void SetLimiterActive(G4bool a) { fLimiterActive = a; }
+    void SetVerbose(G4int v) { fVerbose = v; }
+};
+
+#endif
@@ -7,6 +7,10 @@
 #include "A2EventAction.hh"
 
 class G4Run;
+class A2Profiler;
+class A2Bench;
+class A2Watchdog;
+class A2Metrics;
 
 class A2RunAction : public G4UserRunAction
 {
@@ -17,10 +21,18 @@ class A2RunAction : public G4UserRunAction
   public:
     void BeginOfRunAction(const G4Run*);
     void   EndOfRunAction(const G4Run*);
+    A2Profiler* GetProfiler(){return fProfiler;}
+    void SetBench(A2Bench* bench){fBench=bench;}
+    A2Watchdog* GetWatchdog(){return fWatchdog;}
+    A2Metrics* GetMetrics(){return fMetrics;}
     
  
   private:
   A2EventAction *fEventAction;
+  A2Profiler *fProfiler;    //stepping profiler
+  A2Bench *fBench;          //benchmark report (0 if not used)
+  A2Watchdog *fWatchdog;    //per-event step and wall-time budgets
+  A2Metrics *fMetrics;      //live metrics exporter
 };
 
 #endif
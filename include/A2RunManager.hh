@@ -0,0 +1,69 @@
+// Run manager with a startup report: wall time of the initialization
+// phases (materials, detector setup, geometry, physics tables, ...)
+// and the settings of the persistent physics table and geometry caches
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2RunManager_h
+#define A2RunManager_h 1
+
+#include <vector>
+#include <chrono>
+
+#include "G4RunManager.hh"
+
+class A2RunManagerMessenger;
+
+class A2RunManager : public G4RunManager
+{
+
+public:
+    typedef std::chrono::steady_clock Clock_t;
+
+    struct A2Phase_t {
+        G4String fName;                 // name of the phase
+        G4int fDepth;                   // nesting depth
+        G4double fTime;                 // wall time [s] (negative while running)
+        Clock_t::time_point fStart;     // start of the phase
+    };
+
+protected:
+    Clock_t::time_point fStart;         // creation time (program start)
+    std::vector<A2Phase_t> fPhases;     // phases in order of their start
+    std::vector<size_t> fOpen;          // indices of the running phases
+    G4bool fReported;                   // startup report printed
+    G4String fPhysicsCacheDir;          // physics table cache directory (empty if off)
+    G4String fGeometryCacheDir;         // geometry cache directory (empty if off)
+    A2RunManagerMessenger* fMessenger;  // messenger
+
+    G4String GetPhysicsTableKey() const;
+    G4bool PreparePhysicsTableCache(G4String& dir, G4String& key);
+    void StorePhysicsTableCache(const G4String& dir, const G4String& key);
+
+public:
+    A2RunManager();
+    virtual ~A2RunManager();
+
+    virtual void InitializeGeometry();
+    virtual void InitializePhysics();
+    virtual void RunInitialization();
+
+    void BeginPhase(const G4String& name);
+    void EndPhase();
+    void PrintStartupReport();
+
+    const std::vector<A2Phase_t>& GetPhases() const { return fPhases; }
+    void SetPhysicsCacheDir(const G4String& dir) { fPhysicsCacheDir = dir; }
+    const G4String& GetPhysicsCacheDir() const { return fPhysicsCacheDir; }
+    void SetGeometryCacheDir(const G4String& dir) { fGeometryCacheDir = dir; }
+    const G4String& GetGeometryCacheDir() const { return fGeometryCacheDir; }
+
+    static G4String Hash(const G4String& s);
+    static G4bool MakeDir(const G4String& dir);
+    static void RemoveDir(const G4String& dir);
+
+    static A2RunManager* GetA2RunManager()
+    { return dynamic_cast<A2RunManager*>(G4RunManager::GetRunManager()); }
+};
+
+#endif
+
@@ -0,0 +1,27 @@
+#ifndef A2RunManagerMessenger_h
+#define A2RunManagerMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class A2RunManager;
+class G4UIdirectory;
+class G4UIcmdWithAString;
+
+class A2RunManagerMessenger: public G4UImessenger
+{
+  public:
+    A2RunManagerMessenger(A2RunManager*);
+   ~A2RunManagerMessenger();
+
+    void SetNewValue(G4UIcommand*, G4String);
+
+  private:
+    A2RunManager*                fRunManager;
+    G4UIdirectory*               fCacheDir;
+    G4UIcmdWithAString*          fPhysicsTablesCmd;
+    G4UIcmdWithAString*          fGeometryCmd;
+};
+
+#endif
+
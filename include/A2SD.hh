@@ -23,6 +23,7 @@ public:
   void clear();
   void DrawAll();
   void PrintAll();
+  G4int GetNelements(){return fNelements-1;}
   
 private:
   
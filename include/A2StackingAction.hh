@@ -0,0 +1,79 @@
+// Stacking action: early kill of undetectable and late secondaries and
+// deferral of neutrons born in passive material, with kill counts per class
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2StackingAction_h
+#define A2StackingAction_h 1
+
+#include <vector>
+
+#include "G4UserStackingAction.hh"
+#include "globals.hh"
+
+class G4Region;
+class G4ParticleDefinition;
+class A2StackingActionMessenger;
+
+class A2StackingAction : public G4UserStackingAction
+{
+
+public:
+    enum EClass {
+        kNeutrino,          // neutrinos (killed)
+        kOptical,           // optical photons (killed)
+        kLate,              // born after the readout window (killed)
+        kDeferred,          // neutrons born in passive material (deferred)
+        kDropped,           // deferred tracks dropped at the end of the event
+        kNClass
+    };
+
+protected:
+    // configuration
+    G4bool fKillNeutrinos;                  // kill neutrinos at birth
+    G4bool fKillOptical;                    // kill optical photons at birth
+    G4double fMaxTime;                      // readout window (0 to disable)
+    G4bool fDeferPassive;                   // defer neutrons born in passive regions
+    G4bool fDropDeferred;                   // drop instead of tracking deferred tracks
+    std::vector<G4String> fPassiveNames;    // names of the passive regions
+
+    // cached at begin of run
+    std::vector<const G4Region*> fPassive;  // passive regions
+    const G4ParticleDefinition* fNeutrinos[6];  // neutrinos and anti-neutrinos
+    const G4ParticleDefinition* fOpticalPhoton; // optical photon
+    const G4ParticleDefinition* fNeutron;   // neutron
+
+    G4int fStage;                           // stack stage of the current event
+    G4int fNSecondaries;                    // number of secondaries of the current event
+    G4int fMaxDepth;                        // maximum stack depth of the current event
+    G4long fNClass[kNClass];                // number of tracks per class in the run
+
+    A2StackingActionMessenger* fMessenger;  // messenger
+
+    G4bool IsPassive(const G4Region* r) const;
+
+public:
+    A2StackingAction();
+    virtual ~A2StackingAction();
+
+    virtual G4ClassificationOfNewTrack ClassifyNewTrack(const G4Track* track);
+    virtual void NewStage();
+    virtual void PrepareNewEvent();
+
+    void BeginOfRun();
+    void EndOfRun() const;
+    G4String GetSummary() const;
+
+    G4long GetNClass(EClass c) const { return fNClass[c]; }
+    G4int GetNSecondaries() const { return fNSecondaries; }
+    G4int GetMaxStackDepth() const { return fMaxDepth; }
+
+    void SetKillNeutrinos(G4bool k) { fKillNeutrinos = k; }
+    void SetKillOptical(G4bool k) { fKillOptical = k; }
+    void SetMaxTime(G4double t) { fMaxTime = t; }
+    void SetDeferPassive(G4bool d) { fDeferPassive = d; }
+    void SetDropDeferred(G4bool d) { fDropDeferred = d; }
+    void SetPassiveRegions(const G4String& names);
+};
+
+#endif
+
@@ -0,0 +1,33 @@
+#ifndef A2StackingActionMessenger_h
+#define A2StackingActionMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class A2StackingAction;
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithADoubleAndUnit;
+
+class A2StackingActionMessenger: public G4UImessenger
+{
+  public:
+    A2StackingActionMessenger(A2StackingAction*);
+   ~A2StackingActionMessenger();
+
+    void SetNewValue(G4UIcommand*, G4String);
+
+  private:
+    A2StackingAction*            fStacking;
+    G4UIdirectory*               fStackDir;
+    G4UIcmdWithABool*            fKillNeutrinosCmd;
+    G4UIcmdWithABool*            fKillOpticalCmd;
+    G4UIcmdWithADoubleAndUnit*   fMaxTimeCmd;
+    G4UIcmdWithABool*            fDeferPassiveCmd;
+    G4UIcmdWithABool*            fDropDeferredCmd;
+    G4UIcmdWithAString*          fPassiveRegionsCmd;
+};
+
+#endif
+
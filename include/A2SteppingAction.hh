@@ -6,6 +6,11 @@
 
 class A2DetectorConstruction;
 class A2EventAction;
+class G4ParticleDefinition;
+class G4VProcess;
+class A2Profiler;
+class A2Bench;
+class A2Watchdog;
 
 
 class A2SteppingAction : public G4UserSteppingAction
@@ -15,10 +20,16 @@ class A2SteppingAction : public G4UserSteppingAction
    ~A2SteppingAction();
 
     void UserSteppingAction(const G4Step*);
+    void BeginOfRun(A2Profiler* prof, A2Bench* bench, A2Watchdog* watchdog);
     
   private:
     A2DetectorConstruction* detector;
     A2EventAction*          eventaction;  
+    const G4ParticleDefinition* fGamma;   //cached at begin of run
+    const G4VProcess*           fPhot;    //photo-electric process of gammas (or its biasing wrapper)
+    A2Profiler*                 fProfiler;    //stepping profiler (0 if disabled)
+    A2Bench*                    fBench;       //benchmark step counter (0 if not used)
+    A2Watchdog*                 fWatchdog;    //per-event budgets (0 if disabled)
 };
 
 
@@ -0,0 +1,50 @@
+// Tagged photon beam: energies of the tagger channels are read from a
+// tagger calibration file and sampled according to a tabulated or a
+// bremsstrahlung-like 1/E spectrum
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2TaggedBeam_h
+#define A2TaggedBeam_h 1
+
+#include <vector>
+
+#include "globals.hh"
+#include "A2AliasSampler.hh"
+
+class A2TaggedBeam
+{
+
+protected:
+    G4String fFileName;                 // tagger calibration file
+    std::vector<G4int> fChannel;        // channel numbers
+    std::vector<G4double> fEnergy;      // channel central energies [MeV]
+    std::vector<G4double> fWidth;       // channel widths [MeV]
+    G4bool fTabulated;                  // intensities were read from file
+    A2AliasSampler fSampler;            // channel sampler
+
+public:
+    A2TaggedBeam();
+    virtual ~A2TaggedBeam() { }
+
+    G4bool Load(const char* filename);
+
+    G4bool IsLoaded() const { return !fSampler.IsEmpty(); }
+    const G4String& GetFileName() const { return fFileName; }
+    G4int GetNChannels() const { return fChannel.size(); }
+    G4double GetEMin() const;
+    G4double GetEMax() const;
+
+    G4int FindChannel(G4double e) const;
+    G4double Sample(G4double u1, G4double u2, G4int& channel) const
+    {
+        // Sample a beam energy using the uniform random numbers 'u1'
+        // (channel) and 'u2' (energy within the channel) and save the
+        // tagger channel to 'channel'.
+        G4int i = fSampler.Sample(u1);
+        channel = fChannel[i];
+        return fEnergy[i] + (u2 - 0.5)*fWidth[i];
+    }
+};
+
+#endif
+
@@ -28,6 +28,7 @@ public:
   void SetMaterial(G4Material* mat){fMaterial=mat;}
   void SetLength(G4double l) { fLength = l; }
   void SetRadius(G4double r) { fRadius = r; }
+  void SetCenter(const G4ThreeVector& c) { fCenter = c; }
 
   G4ThreeVector& GetCenter(){return fCenter;}
   G4double GetLength(){return fLength;}
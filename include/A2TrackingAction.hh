@@ -7,12 +7,15 @@
 #include "G4UserTrackingAction.hh"
 
 class A2PrimaryGeneratorAction;
+class A2Profiler;
 
 class A2TrackingAction : public G4UserTrackingAction
 {
 
 private:
     A2PrimaryGeneratorAction* fPGA;     // pointer to generator
+    A2Profiler* fProfiler;              // pointer to stepping profiler
+    G4bool fStoreTrajectories;          // allow trajectory storage (off in batch mode)
 
 public:
     A2TrackingAction();
@@ -20,6 +23,8 @@ public:
 
     virtual void PreUserTrackingAction(const G4Track*);
     virtual void PostUserTrackingAction(const G4Track*);
+
+    void SetStoreTrajectories(G4bool s) { fStoreTrajectories = s; }
 };
 
 #endif
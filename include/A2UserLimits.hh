@@ -0,0 +1,38 @@
+// User limits with kinetic energy thresholds per particle species,
+// applied by G4UserSpecialCuts in the region they are attached to
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2UserLimits_h
+#define A2UserLimits_h 1
+
+#include <vector>
+
+#include "G4UserLimits.hh"
+#include "G4Track.hh"
+
+class A2UserLimits : public G4UserLimits
+{
+
+protected:
+    std::vector<const G4ParticleDefinition*> fDef;  // particles with own threshold
+    std::vector<G4double> fDefMinEkine;             // thresholds of these particles
+
+public:
+    A2UserLimits() : G4UserLimits("A2UserLimits") { }
+    virtual ~A2UserLimits() { }
+
+    void SetMinEkine(const G4ParticleDefinition* def, G4double e);
+    G4int GetNParticles() const { return fDef.size(); }
+
+    virtual G4double GetUserMinEkine(const G4Track& track)
+    {
+        // particle-specific threshold, otherwise the one of all particles
+        const G4ParticleDefinition* def = track.GetDefinition();
+        for (size_t i = 0; i < fDef.size(); i++)
+            if (fDef[i] == def) return fDefMinEkine[i];
+        return uMinEkine;
+    }
+};
+
+#endif
+
@@ -5,6 +5,7 @@
 #define A2UserTrackInformation_h 1
 
 #include "G4VUserTrackInformation.hh"
+#include "G4Allocator.hh"
 
 class G4Track;
 
@@ -15,6 +16,8 @@ private:
     G4int fTrackID;             // Geant4 track id (starting at 1)
     G4int fPartID;              // particle index in generator (starting at 1)
 
+    static G4long fgNCreated;   // number of created objects
+
 public:
     A2UserTrackInformation();
     A2UserTrackInformation(const G4Track* aTrack);
@@ -28,7 +31,27 @@ public:
     void SetPartID(G4int id) { fPartID = id; }
 
     void Print() const;
+
+    inline void* operator new(size_t);
+    inline void operator delete(void* aTrackInfo);
+
+    static G4long GetNCreated() { return fgNCreated; }
 };
 
+// pool of track information objects: every secondary gets its own copy
+// (owned and deleted by G4Track), a shower creates many thousands of them
+extern G4Allocator<A2UserTrackInformation> A2UserTrackInformationAllocator;
+
+inline void* A2UserTrackInformation::operator new(size_t)
+{
+    fgNCreated++;
+    return (void*) A2UserTrackInformationAllocator.MallocSingle();
+}
+
+inline void A2UserTrackInformation::operator delete(void* aTrackInfo)
+{
+    A2UserTrackInformationAllocator.FreeSingle((A2UserTrackInformation*) aTrackInfo);
+}
+
 #endif
 
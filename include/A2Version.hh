@@ -3,3 +3,8 @@
 
 # define A2_VERSION "0.3.1"
 
+
+// hash of the detector sources (set by CMake, used for the geometry cache)
+#ifndef A2_SOURCE_ID
+# define A2_SOURCE_ID "unknown"
+#endif
@@ -0,0 +1,48 @@
+// Sampling of primary vertices from a measured beam-spot histogram and a
+// target density profile using alias tables
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2VertexSampler_h
+#define A2VertexSampler_h 1
+
+#include <vector>
+
+#include "G4ThreeVector.hh"
+#include "A2AliasSampler.hh"
+
+class TH1;
+
+class A2VertexSampler
+{
+
+protected:
+    A2AliasSampler fSpot;               // beam-spot bin sampler
+    std::vector<G4double> fSpotX;       // beam-spot bin lower x-edges [mm]
+    std::vector<G4double> fSpotY;       // beam-spot bin lower y-edges [mm]
+    std::vector<G4double> fSpotW;       // beam-spot bin x-widths [mm]
+    std::vector<G4double> fSpotH;       // beam-spot bin y-widths [mm]
+    A2AliasSampler fProfile;            // target-profile bin sampler
+    std::vector<G4double> fProfileZ;    // target-profile bin lower edges [mm]
+    std::vector<G4double> fProfileW;    // target-profile bin widths [mm]
+
+    static TH1* LoadHistogram(const G4String& spec, G4int dim);
+
+public:
+    A2VertexSampler() { }
+    virtual ~A2VertexSampler() { }
+
+    G4bool LoadBeamSpot(const G4String& spec);
+    G4bool LoadTargetProfile(const G4String& spec);
+
+    G4bool HasBeamSpot() const { return !fSpot.IsEmpty(); }
+    G4bool HasTargetProfile() const { return !fProfile.IsEmpty(); }
+    G4bool IsActive() const { return HasBeamSpot() || HasTargetProfile(); }
+
+    void SampleBeamSpot(G4double& x, G4double& y) const;
+    G4double SampleTargetProfile() const;
+    G4ThreeVector SampleCylinder(G4double t_length, G4double t_center,
+                                 G4double b_diam) const;
+};
+
+#endif
+
@@ -0,0 +1,93 @@
+// Watchdog of runaway events: per-event step and wall-time budgets,
+// clean abort and a trace of the steps that exceeded the budget
+// Author: Dominik Werthmueller, 2026
+
+#ifndef A2Watchdog_h
+#define A2Watchdog_h 1
+
+#include <vector>
+#include <chrono>
+
+#include "globals.hh"
+#include "G4Step.hh"
+
+class G4Event;
+class A2WatchdogMessenger;
+class TFile;
+
+class A2Watchdog
+{
+
+public:
+    typedef std::chrono::steady_clock Clock_t;
+
+    // record of an aborted event
+    struct A2WatchdogRecord_t {
+        G4int fEventID;         // Geant4 event id
+        G4int fInputEntry;      // entry of the event input (-1 if none)
+        G4String fReason;       // exceeded budget
+        G4long fSteps;          // number of steps until the abort
+        G4double fTime;         // wall time until the abort [s]
+        G4String fRndmStatus;   // random engine status at the begin of the event
+        G4String fTrace;        // trace of the last steps
+    };
+
+protected:
+    G4long fMaxSteps;                   // step budget per event (0 to disable)
+    G4double fMaxTime;                  // wall-time budget per event [s] (0 to disable)
+    G4int fTraceSize;                   // number of traced steps before the abort
+
+    // current event
+    G4int fEventID;                     // Geant4 event id
+    G4long fSteps;                      // number of steps
+    Clock_t::time_point fStart;         // start of the event
+    G4String fReason;                   // exceeded budget (empty if none)
+    G4double fTime;                     // wall time when the budget was exceeded [s]
+    G4int fNTraced;                     // number of traced steps
+    G4String fTrace;                    // trace of the steps after the budget was exceeded
+
+    std::vector<A2WatchdogRecord_t> fRecords;   // aborted events of the run
+
+    A2WatchdogMessenger* fMessenger;    // messenger
+
+    void Exceeded(const char* reason);
+    void TraceStep(const G4Step* step);
+
+public:
+    A2Watchdog();
+    virtual ~A2Watchdog();
+
+    void SetMaxSteps(G4long n) { fMaxSteps = n; }
+    void SetMaxTime(G4double t) { fMaxTime = t; }
+    void SetTraceSize(G4int n) { fTraceSize = n; }
+    G4bool IsEnabled() const { return fMaxSteps > 0 || fMaxTime > 0; }
+    G4bool IsTripped() const { return !fReason.empty(); }
+    G4int GetNAborted() const { return fRecords.size(); }
+
+    void BeginOfRun();
+    void BeginOfEvent(const G4Event* evt);
+    void EndOfEvent(const G4Event* evt, G4int inputEntry);
+    void WriteTree(TFile* f) const;
+
+    void Step(const G4Step* step)
+    {
+        // budget already exceeded: trace the following steps, then abort
+        if (!fReason.empty())
+        {
+            TraceStep(step);
+            return;
+        }
+
+        // check the step budget at every step, the time budget only
+        // every 1024 steps to keep the clock out of the stepping loop
+        fSteps++;
+        if (fMaxSteps > 0 && fSteps > fMaxSteps)
+            Exceeded("steps");
+        else if (fMaxTime > 0 && (fSteps & 1023) == 0 &&
+                 std::chrono::duration<G4double>(Clock_t::now() - fStart).count() > fMaxTime)
+            Exceeded("time");
+    }
+};
+
+#endif
+
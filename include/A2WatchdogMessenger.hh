@@ -0,0 +1,29 @@
+#ifndef A2WatchdogMessenger_h
+#define A2WatchdogMessenger_h 1
+
+#include "G4UImessenger.hh"
+#include "globals.hh"
+
+class A2Watchdog;
+class G4UIdirectory;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithADoubleAndUnit;
+
+class A2WatchdogMessenger: public G4UImessenger
+{
+  public:
+    A2WatchdogMessenger(A2Watchdog*);
+   ~A2WatchdogMessenger();
+
+    void SetNewValue(G4UIcommand*, G4String);
+
+  private:
+    A2Watchdog*                  fWatchdog;
+    G4UIdirectory*               fWatchdogDir;
+    G4UIcmdWithAnInteger*        fMaxStepsCmd;
+    G4UIcmdWithADoubleAndUnit*   fMaxTimeCmd;
+    G4UIcmdWithAnInteger*        fTraceSizeCmd;
+};
+
+#endif
+
@@ -0,0 +1,83 @@
+#!/bin/sh
+# Reproducible benchmark suite: runs the fixed-seed standard workloads and
+# appends events/s, steps/s, peak RSS and output bytes/event of each run to
+# a JSON lines report. If a reference report is given, workloads whose
+# events/s dropped by more than BENCH_TOLERANCE (default 0.1) are reported
+# and the script fails.
+#
+# Run from the source directory (also done by 'make A2Bench'):
+#   macros/bench/run_bench.sh build/A2Geant4 [outdir] [reference.json]
+#
+# BENCH_EVENTS scales all workloads to a fixed number of events.
+
+EXE=$1
+OUTDIR=${2:-bench}
+REF=$3
+TOL=${BENCH_TOLERANCE:-0.1}
+
+if [ -z "$EXE" ] || [ ! -x "$EXE" ]; then
+  echo "Usage: $0 A2Geant4-executable [outdir] [reference.json]"
+  exit 1
+fi
+
+mkdir -p "$OUTDIR"
+REPORT=$OUTDIR/bench.json
+rm -f "$REPORT"
+
+# name, detector setup, number of events
+run()
+{
+  NAME=$1
+  DET=$2
+  NUM=${BENCH_EVENTS:-$3}
+  rm -f "$OUTDIR/$NAME.root"
+  echo "=== $NAME ($NUM events)"
+  if ! "$EXE" --mac=macros/bench/$NAME.mac --det=$DET --num=$NUM \
+              --of="$OUTDIR/$NAME.root" --bench="$REPORT" > "$OUTDIR/$NAME.log" 2>&1; then
+    echo "$NAME failed, see $OUTDIR/$NAME.log"
+    FAILED=1
+  fi
+}
+
+FAILED=0
+run gamma_cb            macros/DetectorSetup.mac            5000
+run gamma_1GeV          macros/DetectorSetup.mac            2000
+run pi0_photoproduction macros/DetectorSetup.mac            5000
+run proton_taps         macros/DetectorSetup.mac            5000
+run neutron_background  macros/DetectorSetup.mac            5000
+if [ -f data/field_map_jul_13_pos.dat.xz ]; then
+  run polarized_target  macros/bench/DetectorSetup_pol.mac  2000
+else
+  echo "=== polarized_target skipped (field map data/field_map_jul_13_pos.dat.xz not found)"
+fi
+
+# summary
+echo
+echo "Report: $REPORT"
+awk -F'[:,] *' '{
+  for (i = 1; i < NF; i++) v[$i] = $(i+1)
+  gsub(/[{" ]/, "", v["{\"name\""])
+  printf "%-22s %10.1f events/s %12.0f steps/s %8.1f MB %10.0f bytes/event %10.0f track infos/event\n",
+         v["{\"name\""], v["\"events_per_s\""], v["\"steps_per_s\""],
+         v["\"peak_rss_mb\""], v["\"output_bytes_per_event\""], v["\"track_infos_per_event\""]
+}' "$REPORT"
+
+# comparison with the reference report
+if [ -n "$REF" ]; then
+  echo
+  echo "Comparison with $REF (tolerance $TOL):"
+  awk -v tol="$TOL" -F'[:,] *' '
+    {
+      for (i = 1; i < NF; i++) v[$i] = $(i+1)
+      name = v["{\"name\""]; gsub(/[{" ]/, "", name)
+      if (FNR == NR) { ref[name] = v["\"events_per_s\""]; next }
+      if (!(name in ref) || ref[name] <= 0) { printf "%-22s no reference\n", name; next }
+      r = v["\"events_per_s\""] / ref[name]
+      flag = r < 1 - tol ? "REGRESSION" : "ok"
+      if (r < 1 - tol) bad = 1
+      printf "%-22s %6.3f x reference  %s\n", name, r, flag
+    }
+    END { exit bad }' "$REF" "$REPORT" || FAILED=1
+fi
+
+exit $FAILED
@@ -32,10 +32,33 @@
 #include "A2SteppingAction.hh"
 #include "A2SteppingVerbose.hh"
 #include "A2TrackingAction.hh"
+#include "A2StackingAction.hh"
+#include "A2Bench.hh"
+#include "A2RunManager.hh"
 
 //#include "LHEP_BIC.hh"
 
 #include <getopt.h>
+#include <climits>
+#include <fstream>
+#include <sstream>
+
+// check if a macro (or a macro executed by it) contains visualization commands
+static G4bool MacroUsesVis(const G4String& file, G4int depth = 0)
+{
+  std::ifstream in(file);
+  if (!in.good() || depth > 10) return false;
+  std::string line;
+  while (std::getline(in, line))
+  {
+    std::istringstream iss(line);
+    std::string cmd, arg;
+    iss >> cmd >> arg;
+    if (cmd.compare(0, 5, "/vis/") == 0) return true;
+    if (cmd == "/control/execute" && MacroUsesVis(arg, depth+1)) return true;
+  }
+  return false;
+}
 
 int main(int argc,char** argv) {
   
@@ -49,6 +72,9 @@ int main(int argc,char** argv) {
     {"num",  required_argument,NULL,'n'},
     {"det",  required_argument,NULL,'d'},
     {"gui",  no_argument,NULL,'g'},
+    {"dry-run", no_argument,NULL,'r'},
+    {"bench", required_argument,NULL,'b'},
+    {"resume", no_argument,NULL,'s'},
     {NULL,   0                ,NULL, 0 }
   };
   
@@ -67,6 +93,9 @@ int main(int argc,char** argv) {
   G4bool isOutputSet = false;
   G4bool gotOptions = false; //got some options so use them
   G4bool gui=false; 
+  G4bool dryRun=false;
+  G4String nameFileBench;
+  G4bool resume=false;
   while ( (rez=getopt_long(argc,argv,optsShort,optsLong,&iOpt)) != -1 )
   {
     gotOptions = true;
@@ -74,15 +103,19 @@ int main(int argc,char** argv) {
     {
       case 'h':
 	G4cout << G4endl;
-	G4cout << "Usage: " << argv[0] << " [--mac=file] [--if=file] [--of=file] [--num=N]  [--det=file] [--help]" << G4endl;
+	G4cout << "Usage: " << argv[0] << " [--mac=file] [--if=file] [--of=file] [--num=N]  [--det=file] [--dry-run] [--bench=file] [--resume] [--help]" << G4endl;
 	G4cout << G4endl;
 	G4cout << "Options: " << G4endl;
 	G4cout << "\t-h --help \t print this help and exit" << G4endl;
 	G4cout << "\t-i --if   \t input event file (overwrites /A2/event/setInputFile command in macro)" << G4endl;
+	G4cout << "\t          \t use hepmc:-, lhef:- or a2ev:- to read HepMC3/LHEF/binary events from stdin" << G4endl;
 	G4cout << "\t-m --mac  \t .mac file to run in batch mode" << G4endl;
 	G4cout << "\t-n --num  \t # of events to simulate" << G4endl;
 	G4cout << "\t-d --det  \t detector setup macro" << G4endl;
 	G4cout << "\t-g --gui  \t use gui" << G4endl;
+	G4cout << "\t   --dry-run\t generate/read events only, no tracking (input benchmark)" << G4endl;
+	G4cout << "\t   --bench \t append events/s, steps/s, peak RSS and output bytes/event of the run to a JSON lines file" << G4endl;
+	G4cout << "\t   --resume\t continue the output file from its last checkpoint (see /A2/event/checkpoint)" << G4endl;
 	G4cout << "\t-o --of   \t output file (overwrites /A2/event/setOutputputFile command in macro)" << G4endl;
 	G4cout << G4endl;
 	exit(EXIT_SUCCESS);
@@ -116,6 +149,17 @@ int main(int argc,char** argv) {
       case 'g':
 	gui=true;
 	break;
+      case 'r':
+	dryRun=true;
+	G4cout << "Dry run: events will be generated but not tracked" << G4endl;
+	break;
+      case 'b':
+	nameFileBench=optarg;
+	G4cout << "Benchmark report will be appended to " << nameFileBench << G4endl;
+	break;
+      case 's':
+	resume=true;
+	break;
       case '?':
       default:
 	G4cout << "Unknown option!" << G4endl;
@@ -146,22 +190,30 @@ int main(int argc,char** argv) {
     }
   }
 
+  // Benchmark report (created here to include the initialization in the startup time)
+  A2Bench* bench = 0;
+  if (!nameFileBench.empty()) bench = new A2Bench(nameFileBench, nameFileMac);
+
   // Choose the Random engine
   CLHEP::HepRandom::setTheEngine(new CLHEP::RanecuEngine);
   
   // My verbose output class
   G4VSteppingVerbose::SetInstance(new A2SteppingVerbose);
      
-  // Construct the default run manager
-  G4RunManager * runManager = new G4RunManager;
+  // Construct the run manager (with startup report)
+  A2RunManager * runManager = new A2RunManager;
 
   // Set mandatory initialization classes
+  runManager->BeginPhase("materials");
   A2DetectorConstruction* detector = new A2DetectorConstruction(detSetup);
+  runManager->EndPhase();
   detector->SetIsInteractive(isInteractive);
   runManager->SetUserInitialization(detector);
   //runManager->SetUserInitialization(new LHEP_BIC);
   // Use below insted if cannot install physics_list
+  runManager->BeginPhase("physics list, particles");
   runManager->SetUserInitialization(new A2PhysicsList);
+  runManager->EndPhase();
 
   G4UIsession* session = 0;
   G4UIExecutive* uiexecutive =0;
@@ -172,24 +224,40 @@ int main(int argc,char** argv) {
     else uiexecutive = new G4UIExecutive(argc,argv);
   }
   
+  // Visualization only for interactive sessions and batch macros with /vis/ commands
+  // (e.g. movies), no trajectories are stored otherwise
+  G4bool useVis = isInteractive || MacroUsesVis(nameFileMac);
 #ifdef G4VIS_USE
   // Visualization manager
-  G4VisManager* visManager = new G4VisExecutive;
-  visManager->Initialize();
-  if (!session) visManager->SetVerboseLevel("quiet");
+  G4VisManager* visManager = 0;
+  if (useVis)
+  {
+    runManager->BeginPhase("visualization");
+    visManager = new G4VisExecutive;
+    visManager->Initialize();
+    if (!session) visManager->SetVerboseLevel("quiet");
+    runManager->EndPhase();
+  }
+#else
+  useVis = false;
 #endif
   // Set user action classes
   A2PrimaryGeneratorAction* pga=new A2PrimaryGeneratorAction();
   pga->SetDetCon(detector);
+  pga->SetDryRun(dryRun);
   runManager->SetUserAction(pga);
 
   A2RunAction* runaction = new A2RunAction;  
+  if (bench) runaction->SetBench(bench);
   runManager->SetUserAction(runaction);
   A2EventAction* eventaction = new A2EventAction(runaction, pga, argc, argv, detSetup);
   eventaction->SetIsInteractive(isInteractive);
   runManager->SetUserAction(eventaction);
   runManager->SetUserAction(new A2SteppingAction(detector, eventaction));
-  runManager->SetUserAction(new A2TrackingAction());
+  A2TrackingAction* trackingaction = new A2TrackingAction();
+  trackingaction->SetStoreTrajectories(useVis);
+  runManager->SetUserAction(trackingaction);
+  runManager->SetUserAction(new A2StackingAction());
   // Initialize G4 kernel
 //   runManager->Initialize();
     
@@ -197,7 +265,9 @@ int main(int argc,char** argv) {
   G4UImanager* UI = G4UImanager::GetUIpointer();
 
   // Set macro (and run, ignoring all arguments, if  /run/beamOn command is set in the macro)
+  runManager->BeginPhase("macro " + nameFileMac);
   UI->ApplyCommand("/control/execute " + nameFileMac);
+  runManager->EndPhase();
   
   // Set input file
   if (!nameFileInput.empty())
@@ -212,9 +282,24 @@ int main(int argc,char** argv) {
     }
   
   // Set and prepare input if it has been set
+  runManager->BeginPhase("input");
   pga->SetUpFileInput();
+  runManager->EndPhase();
+
+  // Continue from the last checkpoint of the output file
+  G4int eventsDone = 0;
+  if (resume)
+    {
+      eventsDone = eventaction->ReadCheckpoint();
+      if (eventsDone > 0) pga->SetInputEntry(eventaction->GetResumeInput());
+    }
   
-  if (session||uiexecutive)   // Define UI session for interactive mode.
+  if (resume && eventaction->IsResumeComplete())   // Output already complete, only clean up
+    {
+      delete uiexecutive;
+      delete session;
+    }
+  else if (session||uiexecutive)   // Define UI session for interactive mode.
     {
       // G4UIterminal is a (dumb) terminal.
       if(!gui)session->SessionStart();
@@ -232,15 +317,34 @@ int main(int argc,char** argv) {
 	{
 	  // Run in batch mode
 	  if (numberOfEvents < 0) numberOfEvents=pga->GetNEvents();
-	  G4cout << "Will analyse " << numberOfEvents << " events." << G4endl;
-          eventaction->SetReqEvents(numberOfEvents);
-	  runManager->BeamOn(numberOfEvents);
+	  if (eventsDone > 0 && numberOfEvents > 0)
+	    {
+	      G4cout << "Resuming after " << eventsDone << " of " << numberOfEvents << " events." << G4endl;
+	      numberOfEvents = numberOfEvents > eventsDone ? numberOfEvents - eventsDone : 0;
+	    }
+	  if (numberOfEvents == 0)
+	    {
+	      // e.g. built-in reaction generator without --num
+	      G4cout << "No events to simulate, set the number of events via --num" << G4endl;
+	    }
+	  else if (numberOfEvents < 0)
+	    {
+	      // streamed input: run until the end of the input
+	      G4cout << "Will analyse all events until the end of the input." << G4endl;
+	      runManager->BeamOn(INT_MAX);
+	    }
+	  else
+	    {
+	      G4cout << "Will analyse " << numberOfEvents << " events." << G4endl;
+	      eventaction->SetReqEvents(numberOfEvents);
+	      runManager->BeamOn(numberOfEvents);
+	    }
 	}
     }
   
   // Job termination
 #ifdef G4VIS_USE
-  delete visManager;
+  if (visManager) delete visManager;
 #endif
   delete runManager;
 
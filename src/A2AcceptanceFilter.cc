@@ -0,0 +1,229 @@
+// Event pre-filter on a geometric acceptance map: directions from the
+// target center are classified once by tracing straight rays through the
+// constructed geometry to a sensitive detector volume
+// Author: Dominik Werthmueller, 2026
+
+#include "G4Navigator.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalVolume.hh"
+#include "CLHEP/Units/SystemOfUnits.h"
+#include "CLHEP/Units/PhysicalConstants.h"
+#include "Randomize.hh"
+
+#include "A2AcceptanceFilter.hh"
+#include "A2FileGenerator.hh"
+
+using namespace CLHEP;
+
+const G4double A2AcceptanceFilter::fgMaxDecayLength = 10*m;
+
+//______________________________________________________________________________
+A2AcceptanceFilter::A2AcceptanceFilter()
+{
+    // Constructor.
+
+    // init members
+    fMode = kOff;
+    fKeepFraction = 0.1;
+    fNTheta = 180;
+    fNPhi = 360;
+    fNEvents = 0;
+    fNOutside = 0;
+    fNRejected = 0;
+}
+
+//______________________________________________________________________________
+G4bool A2AcceptanceFilter::SetMode(const G4String& mode)
+{
+    // Set the filter mode by name. Return false if the name is unknown.
+
+    if (mode == "off")
+        fMode = kOff;
+    else if (mode == "skip")
+        fMode = kSkip;
+    else if (mode == "weight")
+        fMode = kWeight;
+    else
+    {
+        G4cout << "A2AcceptanceFilter::SetMode(): Unknown mode '" << mode
+               << "' (off, skip, weight)" << G4endl;
+        return false;
+    }
+
+    return true;
+}
+
+//______________________________________________________________________________
+const char* A2AcceptanceFilter::GetModeName() const
+{
+    // Return the name of the filter mode.
+
+    switch (fMode)
+    {
+        case kSkip:
+            return "skip";
+        case kWeight:
+            return "weight";
+        default:
+            return "off";
+    }
+}
+
+//______________________________________________________________________________
+G4bool A2AcceptanceFilter::TraceRay(G4Navigator& nav, const G4ThreeVector& dir) const
+{
+    // Follow the straight ray from the origin in the direction 'dir' through
+    // the geometry of the navigator 'nav'. Return true if a sensitive volume
+    // is crossed.
+
+    G4ThreeVector pos = fOrigin;
+    nav.ResetStackAndState();
+    G4VPhysicalVolume* pv = nav.LocateGlobalPointAndSetup(pos, &dir, false, false);
+
+    // limit the number of steps for safety
+    for (G4int i = 0; pv && i < 10000; i++)
+    {
+        if (pv->GetLogicalVolume()->GetSensitiveDetector())
+            return true;
+
+        // step to the next volume boundary
+        G4double safety;
+        G4double step = nav.ComputeStep(pos, dir, kInfinity, safety);
+        if (step == kInfinity)
+            break;
+        pos += step*dir;
+        nav.SetGeometricallyLimitedStep();
+        pv = nav.LocateGlobalPointAndSetup(pos, &dir, true);
+    }
+
+    return false;
+}
+
+//______________________________________________________________________________
+void A2AcceptanceFilter::Build(G4VPhysicalVolume* world, const G4ThreeVector& origin)
+{
+    // Build the acceptance map of the geometry 'world' for rays starting at
+    // 'origin'. A bin is accepted if the ray through its center or through
+    // one of its corners hits a sensitive volume, which keeps the map
+    // conservative for the curved tracks of charged particles.
+
+    fOrigin = origin;
+    fMap.assign(fNTheta*fNPhi, false);
+
+    // navigator shared by all rays
+    G4Navigator nav;
+    nav.SetWorldVolume(world);
+
+    // trace rays through the bin corners
+    G4double dTheta = pi / fNTheta;
+    G4double dPhi = twopi / fNPhi;
+    std::vector<G4bool> corner((fNTheta+1)*fNPhi);
+    for (G4int i = 0; i <= fNTheta; i++)
+    {
+        for (G4int j = 0; j < fNPhi; j++)
+        {
+            G4ThreeVector dir;
+            dir.setRThetaPhi(1, i*dTheta, j*dPhi);
+            corner[i*fNPhi+j] = TraceRay(nav, dir);
+        }
+    }
+
+    // classify bins
+    G4int nIn = 0;
+    for (G4int i = 0; i < fNTheta; i++)
+    {
+        for (G4int j = 0; j < fNPhi; j++)
+        {
+            G4int jn = (j+1) % fNPhi;
+            G4bool in = corner[i*fNPhi+j] || corner[i*fNPhi+jn] ||
+                        corner[(i+1)*fNPhi+j] || corner[(i+1)*fNPhi+jn];
+            if (!in)
+            {
+                G4ThreeVector dir;
+                dir.setRThetaPhi(1, (i+0.5)*dTheta, (j+0.5)*dPhi);
+                in = TraceRay(nav, dir);
+            }
+            fMap[i*fNPhi+j] = in;
+            if (in) nIn++;
+        }
+    }
+
+    G4cout << "A2AcceptanceFilter::Build(): " << nIn << " of " << fNTheta*fNPhi
+           << " direction bins in the acceptance" << G4endl;
+}
+
+//______________________________________________________________________________
+G4bool A2AcceptanceFilter::IsInAcceptance(const G4ThreeVector& dir) const
+{
+    // Check if the direction 'dir' is in the acceptance.
+
+    G4int i = G4int(dir.theta() / pi * fNTheta);
+    G4double phi = dir.phi();
+    if (phi < 0) phi += twopi;
+    G4int j = G4int(phi / twopi * fNPhi);
+    if (i >= fNTheta) i = fNTheta - 1;
+    if (j >= fNPhi) j = fNPhi - 1;
+
+    return fMap[i*fNPhi+j];
+}
+
+//______________________________________________________________________________
+G4bool A2AcceptanceFilter::DecaysInFlight(const A2FileGenerator* gen, G4int p) const
+{
+    // Check if the particle 'p' of the current event of the generator 'gen'
+    // is likely to decay before reaching the detectors, i.e. its decay
+    // products can be emitted in any direction.
+
+    const G4ParticleDefinition* def = gen->GetParticleDefinition(p);
+    if (!def || def->GetPDGStable() || def->GetPDGMass() <= 0)
+        return false;
+
+    // mean decay length in the lab
+    G4double length = def->GetPDGLifeTime() * c_light *
+                      gen->GetParticleMomentum(p).mag() / def->GetPDGMass();
+
+    return length < fgMaxDecayLength;
+}
+
+//______________________________________________________________________________
+G4bool A2AcceptanceFilter::IsInside(const A2FileGenerator* gen) const
+{
+    // Check if any tracked particle of the current event of the generator
+    // 'gen' is in the acceptance. Particles decaying in flight are always
+    // in the acceptance.
+
+    for (G4int i = 0; i < gen->GetNParticles(); i++)
+    {
+        if (!gen->IsParticleTrack(i))
+            continue;
+        if (DecaysInFlight(gen, i) || IsInAcceptance(gen->GetParticleMomentum(i)))
+            return true;
+    }
+
+    return false;
+}
+
+//______________________________________________________________________________
+G4bool A2AcceptanceFilter::Select(const A2FileGenerator* gen, G4double& weight)
+{
+    // Decide if the current event of the generator 'gen' is kept. If so,
+    // return true and set the event weight to 'weight'.
+
+    fNEvents++;
+    weight = 1;
+    if (IsInside(gen))
+        return true;
+    fNOutside++;
+
+    // keep a fraction of the events in weight mode
+    if (fMode == kWeight && fKeepFraction > 0 && G4UniformRand() < fKeepFraction)
+    {
+        weight = 1. / fKeepFraction;
+        return true;
+    }
+
+    fNRejected++;
+    return false;
+}
+
@@ -0,0 +1,73 @@
+// Sampling of discrete distributions in constant time using alias tables
+// (Walker/Vose alias method)
+// Author: Dominik Werthmueller, 2026
+
+#include "globals.hh"
+
+#include "A2AliasSampler.hh"
+
+//______________________________________________________________________________
+G4bool A2AliasSampler::Init(const std::vector<G4double>& weights)
+{
+    // Build the alias table for the bin weights 'weights'.
+
+    G4int n = weights.size();
+    fProb.clear();
+    fAlias.clear();
+
+    // sum of weights
+    G4double sum = 0;
+    for (G4int i = 0; i < n; i++)
+    {
+        if (weights[i] < 0)
+        {
+            G4cout << "A2AliasSampler::Init(): Negative weight in bin " << i << "!" << G4endl;
+            return false;
+        }
+        sum += weights[i];
+    }
+    if (n == 0 || sum <= 0)
+    {
+        G4cout << "A2AliasSampler::Init(): Empty distribution!" << G4endl;
+        return false;
+    }
+
+    // scaled probabilities and work lists
+    fProb.resize(n);
+    fAlias.resize(n);
+    std::vector<G4int> small;
+    std::vector<G4int> large;
+    for (G4int i = 0; i < n; i++)
+    {
+        fProb[i] = weights[i] * n / sum;
+        fAlias[i] = i;
+        if (fProb[i] < 1)
+            small.push_back(i);
+        else
+            large.push_back(i);
+    }
+
+    // pair small with large bins
+    while (!small.empty() && !large.empty())
+    {
+        G4int s = small.back();
+        G4int l = large.back();
+        small.pop_back();
+        large.pop_back();
+        fAlias[s] = l;
+        fProb[l] -= 1 - fProb[s];
+        if (fProb[l] < 1)
+            small.push_back(l);
+        else
+            large.push_back(l);
+    }
+
+    // remaining bins are full (up to rounding)
+    for (G4int i = 0; i < (G4int)small.size(); i++)
+        fProb[small[i]] = 1;
+    for (G4int i = 0; i < (G4int)large.size(); i++)
+        fProb[large[i]] = 1;
+
+    return true;
+}
+
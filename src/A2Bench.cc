@@ -0,0 +1,138 @@
+// Benchmark report of a run: event and step rates, peak memory and
+// output size, appended as one JSON line per run
+// Author: Dominik Werthmueller, 2026
+
+#include <fstream>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#include <sys/utsname.h>
+
+#include "G4Version.hh"
+
+#include "A2Bench.hh"
+#include "A2Version.hh"
+#include "A2UserTrackInformation.hh"
+
+//______________________________________________________________________________
+A2Bench::A2Bench(const G4String& file, const G4String& macro)
+{
+    // Constructor. Create before the run manager to include the
+    // initialization in the startup time.
+
+    // init members
+    fFile = file;
+    fCreated = Clock_t::now();
+    fStartup = -1;
+    fTime = 0;
+    fNEvents = 0;
+    fNSteps = 0;
+    fNTrackInfo = 0;
+
+    // name the workload after the macro file
+    fName = macro;
+    size_t pos = fName.find_last_of("/");
+    if (pos != std::string::npos)
+        fName = fName.substr(pos+1);
+    pos = fName.rfind(".mac");
+    if (pos != std::string::npos)
+        fName = fName.substr(0, pos);
+}
+
+//______________________________________________________________________________
+void A2Bench::BeginOfRun()
+{
+    // Reset the counters and start the timer.
+
+    fTime = 0;
+    fNEvents = 0;
+    fNSteps = 0;
+    fNTrackInfo = A2UserTrackInformation::GetNCreated();   // baseline, count of the run after EndOfRun()
+    fStart = Clock_t::now();
+
+    // startup: geometry, physics tables, visualization and macro
+    if (fStartup < 0)
+        fStartup = std::chrono::duration<G4double>(fStart - fCreated).count();
+}
+
+//______________________________________________________________________________
+void A2Bench::EndOfRun(G4int nEvents)
+{
+    // Stop the timer (before the output file is closed).
+
+    fTime = std::chrono::duration<G4double>(Clock_t::now() - fStart).count();
+    fNEvents = nEvents;
+    fNTrackInfo = A2UserTrackInformation::GetNCreated() - fNTrackInfo;
+}
+
+//______________________________________________________________________________
+G4double A2Bench::GetPeakRSS()
+{
+    // Return the peak resident set size of the process in MB.
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage))
+        return 0;
+#ifdef __APPLE__
+    // bytes on macOS
+    return usage.ru_maxrss / 1024. / 1024.;
+#else
+    // kilobytes on Linux
+    return usage.ru_maxrss / 1024.;
+#endif
+}
+
+//______________________________________________________________________________
+G4bool A2Bench::Write(const G4String& outFile) const
+{
+    // Append the report of the run to the JSON lines file. The size of the
+    // closed output file 'outFile' is used for the output bytes per event.
+
+    std::ofstream out(fFile, std::ios::app);
+    if (!out.good())
+    {
+        G4cout << "A2Bench::Write(): Could not open the file " << fFile << "!" << G4endl;
+        return false;
+    }
+
+    // output size
+    G4double bytes = 0;
+    struct stat st;
+    if (!outFile.empty() && !stat(outFile.c_str(), &st))
+        bytes = st.st_size;
+
+    G4String g4version = G4Version;
+    size_t pos = g4version.find("geant4-");
+    if (pos != std::string::npos)
+        g4version = g4version.substr(pos, g4version.find_first_of(" $", pos) - pos);
+
+    struct utsname unameBuffer;
+    uname(&unameBuffer);
+
+    G4double t = fTime > 0 ? fTime : 1;
+    G4double n = fNEvents > 0 ? fNEvents : 1;
+    out << "{\"name\": \"" << fName << "\""
+        << ", \"version\": \"" << A2_VERSION << "\""
+        << ", \"geant4\": \"" << g4version << "\""
+        << ", \"host\": \"" << unameBuffer.nodename << "\""
+        << ", \"events\": " << fNEvents
+        << ", \"steps\": " << fNSteps
+        << ", \"startup_s\": " << (fStartup > 0 ? fStartup : 0)
+        << ", \"time_s\": " << fTime
+        << ", \"events_per_s\": " << fNEvents / t
+        << ", \"steps_per_s\": " << fNSteps / t
+        << ", \"steps_per_event\": " << fNSteps / n
+        << ", \"peak_rss_mb\": " << GetPeakRSS()
+        << ", \"output_bytes\": " << (G4long)bytes
+        << ", \"output_bytes_per_event\": " << bytes / n
+        << ", \"track_infos_per_event\": " << fNTrackInfo / n
+        << ", \"track_info_pool_kb\": " << A2UserTrackInformationAllocator.GetAllocatedSize() / 1024.
+        << "}" << std::endl;
+
+    G4cout << "A2Bench::Write(): " << fName << ": " << fStartup << " s startup, "
+           << fNEvents / t << " events/s, "
+           << fNSteps / t << " steps/s, " << GetPeakRSS() << " MB peak RSS, "
+           << bytes / n << " output bytes/event -> " << fFile << G4endl;
+
+    return true;
+}
+
@@ -0,0 +1,180 @@
+// Geant4 biasing operator scaling the cross sections of selected physics
+// processes (e.g. rare hadronic channels) of selected primary particles
+// Author: Dominik Werthmueller, 2026
+
+#include <cfloat>
+
+#include "G4BiasingProcessInterface.hh"
+#include "G4BiasingProcessSharedData.hh"
+#include "G4BOptnChangeCrossSection.hh"
+#include "G4ParticleTable.hh"
+#include "G4ProcessManager.hh"
+#include "G4LogicalVolumeStore.hh"
+#include "G4Track.hh"
+
+#include "A2BiasingOperator.hh"
+
+//______________________________________________________________________________
+A2BiasingOperator::A2BiasingOperator()
+    : G4VBiasingOperator("A2BiasingOperator")
+{
+    // Constructor.
+
+}
+
+//______________________________________________________________________________
+A2BiasingOperator::~A2BiasingOperator()
+{
+    // Destructor.
+
+    std::map<const G4BiasingProcessInterface*, G4BOptnChangeCrossSection*>::iterator it;
+    for (it = fOperations.begin(); it != fOperations.end(); ++it)
+        delete it->second;
+}
+
+//______________________________________________________________________________
+void A2BiasingOperator::AddBias(const G4String& particle, const G4String& process, G4double factor)
+{
+    // Scale the cross section of the process 'process' ("all" for all
+    // physics processes) of the particle 'particle' by 'factor'.
+
+    A2XSBias_t bias = { particle, process, factor };
+    fBias.push_back(bias);
+}
+
+//______________________________________________________________________________
+std::vector<G4String> A2BiasingOperator::GetParticles() const
+{
+    // Return the list of biased particles.
+
+    std::vector<G4String> list;
+    for (G4int i = 0; i < (G4int)fBias.size(); i++)
+    {
+        G4bool found = false;
+        for (G4int j = 0; j < (G4int)list.size(); j++)
+            if (list[j] == fBias[i].fParticle)
+                found = true;
+        if (!found)
+            list.push_back(fBias[i].fParticle);
+    }
+    return list;
+}
+
+//______________________________________________________________________________
+void A2BiasingOperator::AttachToAllVolumes()
+{
+    // Attach the operator to all logical volumes.
+
+    G4LogicalVolumeStore* store = G4LogicalVolumeStore::GetInstance();
+    for (size_t i = 0; i < store->size(); i++)
+        AttachTo((*store)[i]);
+}
+
+//______________________________________________________________________________
+void A2BiasingOperator::StartRun()
+{
+    // Create the cross-section change operations for all wrapped processes
+    // of the biased particles.
+
+    for (G4int i = 0; i < (G4int)fBias.size(); i++)
+    {
+        // get particle
+        G4ParticleDefinition* part = G4ParticleTable::GetParticleTable()->FindParticle(fBias[i].fParticle);
+        if (!part)
+        {
+            G4cout << "A2BiasingOperator::StartRun(): Unknown particle " << fBias[i].fParticle << "!" << G4endl;
+            continue;
+        }
+        const G4BiasingProcessSharedData* sharedData =
+            G4BiasingProcessInterface::GetSharedData(part->GetProcessManager());
+        if (!sharedData)
+        {
+            G4cout << "A2BiasingOperator::StartRun(): Processes of " << fBias[i].fParticle
+                   << " are not set up for biasing!" << G4endl;
+            continue;
+        }
+
+        // loop over wrapped physics processes
+        G4bool found = false;
+        const std::vector<const G4BiasingProcessInterface*>& procs = sharedData->GetPhysicsBiasingProcessInterfaces();
+        for (size_t j = 0; j < procs.size(); j++)
+        {
+            const G4String& name = procs[j]->GetWrappedProcess()->GetProcessName();
+            if (fBias[i].fProcess != "all" && fBias[i].fProcess != name)
+                continue;
+
+            // create operation
+            if (fOperations.find(procs[j]) == fOperations.end())
+                fOperations[procs[j]] = new G4BOptnChangeCrossSection("XSchange-" + name);
+            fFactors[procs[j]] = fBias[i].fFactor;
+            found = true;
+
+            G4cout << "A2BiasingOperator::StartRun(): Scaling cross section of " << name
+                   << " for " << fBias[i].fParticle << " by " << fBias[i].fFactor << G4endl;
+        }
+        if (!found)
+        {
+            G4cout << "A2BiasingOperator::StartRun(): Process " << fBias[i].fProcess
+                   << " of " << fBias[i].fParticle << " not found!" << G4endl;
+        }
+    }
+}
+
+//______________________________________________________________________________
+G4VBiasingOperation* A2BiasingOperator::ProposeOccurenceBiasingOperation(const G4Track* track,
+                                                                        const G4BiasingProcessInterface* callingProcess)
+{
+    // Return the cross-section change operation of the calling process.
+    // Only primary tracks are biased as only their weights are propagated
+    // to the event weight.
+
+    // secondaries are simulated analog
+    if (track->GetParentID() != 0)
+        return 0;
+
+    // check if process is biased
+    std::map<const G4BiasingProcessInterface*, G4BOptnChangeCrossSection*>::iterator it = fOperations.find(callingProcess);
+    if (it == fOperations.end())
+        return 0;
+
+    // analog cross section
+    G4double analogLength = callingProcess->GetWrappedProcess()->GetCurrentInteractionLength();
+    if (analogLength > DBL_MAX/10.)
+        return 0;
+    G4double analogXS = 1./analogLength;
+
+    // set biased cross section, sample a new interaction length only after
+    // an interaction occurred
+    G4BOptnChangeCrossSection* operation = it->second;
+    G4double biasedXS = fFactors[callingProcess] * analogXS;
+    G4VBiasingOperation* previous = callingProcess->GetPreviousOccurenceBiasingOperation();
+    if (previous == 0 || operation->GetInteractionOccured())
+    {
+        operation->SetBiasedCrossSection(biasedXS);
+        operation->Sample();
+    }
+    else
+    {
+        operation->UpdateForStep(callingProcess->GetPreviousStepSize());
+        operation->SetBiasedCrossSection(biasedXS);
+        operation->UpdateForStep(0.0);
+    }
+
+    return operation;
+}
+
+//______________________________________________________________________________
+void A2BiasingOperator::OperationApplied(const G4BiasingProcessInterface* callingProcess,
+                                         G4BiasingAppliedCase,
+                                         G4VBiasingOperation* occurenceOperationApplied,
+                                         G4double,
+                                         G4VBiasingOperation*,
+                                         const G4VParticleChange*)
+{
+    // Mark an occurred interaction of a biased process.
+
+    std::map<const G4BiasingProcessInterface*, G4BOptnChangeCrossSection*>::iterator it = fOperations.find(callingProcess);
+    if (it != fOperations.end() && it->second == occurenceOperationApplied)
+        it->second->SetInteractionOccured();
+}
+
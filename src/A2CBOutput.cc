@@ -1,5 +1,6 @@
 #include "A2CBOutput.hh"
 #include "A2FileGenerator.hh"
+#include "A2TaggedBeam.hh"
 #include "G4RunManager.hh"
 #include "CLHEP/Units/SystemOfUnits.h"
 
@@ -35,6 +36,7 @@ A2CBOutput::A2CBOutput(){
   //create Tree
   fTree=new TTree("h12","Crystals");
   fTree->SetAutoSave();
+  fAttach=false;
 
   //Collection IDs for decoding hit collections
   fCBCollID = -1;
@@ -43,6 +45,13 @@ A2CBOutput::A2CBOutput(){
   // store IDs of primary particles
   fStorePrimaries = true;
 
+  // per-event cost statistics
+  fStoreEventStats = false;
+  fcputime = 0;
+  fnsteps = 0;
+  fnsec = 0;
+  fmaxstack = 0;
+
   //TOF stuff
   if(fDET->GetNToFbars()>0){
     fToFTot=fDET->GetNToFbars();
@@ -55,6 +64,7 @@ A2CBOutput::A2CBOutput(){
   }
 
   fweight = 1;
+  ftagch = -1;
 }
 A2CBOutput::~A2CBOutput(){
   delete fidpart;
@@ -63,6 +73,23 @@ A2CBOutput::~A2CBOutput(){
   // for(Int_t i=0;i<fnpart;i++) delete fdircos[i];
   if(fTree)delete fTree;
 }
+void A2CBOutput::AttachTree(TTree* t){
+  //continue an existing tree (resumed run), replaces the new tree
+  if(fTree)delete fTree;
+  fTree=t;
+  fAttach=true;
+}
+void A2CBOutput::AddBranch(const char* name,void* address,const char* leaflist,Int_t basket){
+  //set the address of the branch of an attached tree, otherwise create it
+  if(fAttach){
+    if(!fTree->GetBranch(name)){
+      G4cerr<<"A2CBOutput::AddBranch() Branch "<<name<<" not found in the existing tree, the output options have changed!"<<G4endl;
+      exit(1);
+    }
+    fTree->SetBranchAddress(name,address);
+  }
+  else fTree->Branch(name,address,leaflist,basket);
+}
 //Float_t dircos[4][3];
 void A2CBOutput::SetBranches(){
 
@@ -72,67 +99,76 @@ void A2CBOutput::SetBranches(){
   }
   Int_t basket =64000;
 
-  fTree->Branch("nhits",&fnhits,"fnhits/I",basket);
-  fTree->Branch("npart",&fnpart,"fnpart/I",basket);
-  fTree->Branch("ntaps",&fntaps,"fntaps/I",basket);
-  fTree->Branch("nvtaps",&fnvtaps,"fnvtaps/I",basket);
-  fTree->Branch("vhits",&fvhits,"fvhits/I",basket);
-  fTree->Branch("plab",fplab,"fplab[fnpart]/F",basket);
-  fTree->Branch("tctaps",ftctaps,"ftctaps[fntaps]/F",basket);
-  fTree->Branch("vertex",fvertex,"fvertex[3]/F",basket);
-  fTree->Branch("beam",fbeam,"fbeam[5]/F",basket);
-  fTree->Branch("dircos",fdircos,"fdircos[fnpart][3]/F",basket);
-  fTree->Branch("ecryst",fecryst,"fecryst[fnhits]/F",basket);
-  fTree->Branch("tcryst",ftcryst,"ftcryst[fnhits]/F",basket);
-  fTree->Branch("ectapfs",fectapfs,"fectapfs[fntaps]/F",basket);
-  fTree->Branch("ectapsl",fectapsl,"fectapsl[fntaps]/F",basket);
-  fTree->Branch("elab",felab,"felab[fnpart]/F",basket);
-  fTree->Branch("eleak",&feleak,"feleak/F",basket);
-  fTree->Branch("enai",&fenai,"fenai/F",basket);
-  fTree->Branch("etot",&fetot,"fetot/F",basket);
-  fTree->Branch("eveto",feveto,"feveto[fvhits]/F",basket);
-  fTree->Branch("tveto",ftveto,"ftveto[fvhits]/F",basket);
-  fTree->Branch("evtaps",fevtaps,"fevtaps[fnvtaps]/F",basket);
-  fTree->Branch("icryst",ficryst,"ficryst[fnhits]/I",basket);
-  fTree->Branch("ictaps",fictaps,"fictaps[fntaps]/I",basket);
+  AddBranch("nhits",&fnhits,"fnhits/I",basket);
+  AddBranch("npart",&fnpart,"fnpart/I",basket);
+  AddBranch("ntaps",&fntaps,"fntaps/I",basket);
+  AddBranch("nvtaps",&fnvtaps,"fnvtaps/I",basket);
+  AddBranch("vhits",&fvhits,"fvhits/I",basket);
+  AddBranch("plab",fplab,"fplab[fnpart]/F",basket);
+  AddBranch("tctaps",ftctaps,"ftctaps[fntaps]/F",basket);
+  AddBranch("vertex",fvertex,"fvertex[3]/F",basket);
+  AddBranch("beam",fbeam,"fbeam[5]/F",basket);
+  AddBranch("dircos",fdircos,"fdircos[fnpart][3]/F",basket);
+  AddBranch("ecryst",fecryst,"fecryst[fnhits]/F",basket);
+  AddBranch("tcryst",ftcryst,"ftcryst[fnhits]/F",basket);
+  AddBranch("ectapfs",fectapfs,"fectapfs[fntaps]/F",basket);
+  AddBranch("ectapsl",fectapsl,"fectapsl[fntaps]/F",basket);
+  AddBranch("elab",felab,"felab[fnpart]/F",basket);
+  AddBranch("eleak",&feleak,"feleak/F",basket);
+  AddBranch("enai",&fenai,"fenai/F",basket);
+  AddBranch("etot",&fetot,"fetot/F",basket);
+  AddBranch("eveto",feveto,"feveto[fvhits]/F",basket);
+  AddBranch("tveto",ftveto,"ftveto[fvhits]/F",basket);
+  AddBranch("evtaps",fevtaps,"fevtaps[fnvtaps]/F",basket);
+  AddBranch("icryst",ficryst,"ficryst[fnhits]/I",basket);
+  AddBranch("ictaps",fictaps,"fictaps[fntaps]/I",basket);
   if (fStorePrimaries)
   {
     G4cout << "Storing IDs of primary particles" << G4endl;
-    fTree->Branch("pcryst",fpcryst,"fpcryst[fnhits]/I",basket);
-    fTree->Branch("pctaps",fpctaps,"fpctaps[fntaps]/I",basket);
-    fTree->Branch("pveto",fpveto,"fpveto[fvhits]/I",basket);
-    fTree->Branch("pvtaps",fpvtaps,"fpvtaps[fnvtaps]/I",basket);
+    AddBranch("pcryst",fpcryst,"fpcryst[fnhits]/I",basket);
+    AddBranch("pctaps",fpctaps,"fpctaps[fntaps]/I",basket);
+    AddBranch("pveto",fpveto,"fpveto[fvhits]/I",basket);
+    AddBranch("pvtaps",fpvtaps,"fpvtaps[fnvtaps]/I",basket);
   }
-  fTree->Branch("ivtaps",fivtaps,"fictaps[fnvtaps]/I",basket);
-  fTree->Branch("idpart",fidpart,"fidpart[fnpart]/I",basket);
-  fTree->Branch("iveto",fiveto,"fiveto[fvhits]/I",basket);
+  AddBranch("ivtaps",fivtaps,"fictaps[fnvtaps]/I",basket);
+  AddBranch("idpart",fidpart,"fidpart[fnpart]/I",basket);
+  AddBranch("iveto",fiveto,"fiveto[fvhits]/I",basket);
   if (fDET->GetUseMWPC() && fDET->GetUseMWPC() / 10 == 0)
   {
-    fTree->Branch("nmwpc",&fnmwpc,"fnmwpc/I",basket);
-    fTree->Branch("imwpc",fimwpc,"fimwpc[fnmwpc]/I",basket);
-    fTree->Branch("mposx",fmposx,"fmposx[fnmwpc]/F",basket);
-    fTree->Branch("mposy",fmposy,"fmposy[fnmwpc]/F",basket);
-    fTree->Branch("mposz",fmposz,"fmposz[fnmwpc]/F",basket);
-    fTree->Branch("emwpc",femwpc,"femwpc[fnmwpc]/F",basket);
+    AddBranch("nmwpc",&fnmwpc,"fnmwpc/I",basket);
+    AddBranch("imwpc",fimwpc,"fimwpc[fnmwpc]/I",basket);
+    AddBranch("mposx",fmposx,"fmposx[fnmwpc]/F",basket);
+    AddBranch("mposy",fmposy,"fmposy[fnmwpc]/F",basket);
+    AddBranch("mposz",fmposz,"fmposz[fnmwpc]/F",basket);
+    AddBranch("emwpc",femwpc,"femwpc[fnmwpc]/F",basket);
   }
   else
     G4cout<<"A2CBOutput::SetBranches() Disabling MWPC readout"<<G4endl;
   //tof stuff
   if(fToFTot>0){
-    fTree->Branch("ntof",&fntof,"fntof/I",basket);
-    fTree->Branch("tofi",ftofi,"ftofi[fntof]/I",basket);
-    fTree->Branch("tofe",ftofe,"ftofe[fntof]/F",basket);
-    fTree->Branch("toft",ftoft,"ftoft[fntof]/F",basket);
-    fTree->Branch("tofx",ftofx,"ftofx[fntof]/F",basket);
-    fTree->Branch("tofy",ftofy,"ftofy[fntof]/F",basket);
-    fTree->Branch("tofz",ftofz,"ftofz[fntof]/F",basket);
+    AddBranch("ntof",&fntof,"fntof/I",basket);
+    AddBranch("tofi",ftofi,"ftofi[fntof]/I",basket);
+    AddBranch("tofe",ftofe,"ftofe[fntof]/F",basket);
+    AddBranch("toft",ftoft,"ftoft[fntof]/F",basket);
+    AddBranch("tofx",ftofx,"ftofx[fntof]/F",basket);
+    AddBranch("tofy",ftofy,"ftofy[fntof]/F",basket);
+    AddBranch("tofz",ftofz,"ftofz[fntof]/F",basket);
+  }
+  AddBranch("npiz",&fnpiz,"fnpiz/I",basket);
+  AddBranch("ipiz",fipiz,"fipiz[fnpiz]/I",basket);
+  AddBranch("epiz",fepiz,"fepiz[fnpiz]/F",basket);
+  AddBranch("tpiz",ftpiz,"ftpiz[fnpiz]/F",basket);
+  AddBranch("weight",&fweight,"fweight/F",basket);
+  if (fPGA->GetTaggedBeam()->IsLoaded())
+    AddBranch("tagch",&ftagch,"ftagch/I",basket);
+  if (fStoreEventStats)
+  {
+    G4cout << "Storing per-event CPU time, steps, secondaries and stack depth" << G4endl;
+    AddBranch("cputime",&fcputime,"fcputime/F",basket);
+    AddBranch("nsteps",&fnsteps,"fnsteps/L",basket);
+    AddBranch("nsec",&fnsec,"fnsec/I",basket);
+    AddBranch("maxstack",&fmaxstack,"fmaxstack/I",basket);
   }
-  fTree->Branch("npiz",&fnpiz,"fnpiz/I",basket);
-  fTree->Branch("ipiz",fipiz,"fipiz[fnpiz]/I",basket);
-  fTree->Branch("epiz",fepiz,"fepiz[fnpiz]/F",basket);
-  fTree->Branch("tpiz",ftpiz,"ftpiz[fnpiz]/F",basket);
-  if (fPGA->GetFileGen()->GetType() == A2FileGenerator::kGiBUU)
-    fTree->Branch("weight",&fweight,"fweight/F",basket);
  }
 void A2CBOutput::WriteHit(G4HCofThisEvent* HitsColl){
   G4int CollSize=HitsColl->GetNumberOfCollections();
@@ -248,5 +284,8 @@ void A2CBOutput::WriteGenInput(){
     fplab[i]=fGenLorentzVec[i]->Rho()/GeV;
     fidpart[i]=fGenPartType[i];
   }
-  fweight = fPGA->GetFileGen()->GetWeight();
+  //generator weight times importance weight of the event biasing
+  fweight = fPGA->GetFileGen() ? fPGA->GetFileGen()->GetWeight() : 1;
+  fweight *= fPGA->GetEventWeight();
+  ftagch = fPGA->GetTaggerChannel();
 }
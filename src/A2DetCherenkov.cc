@@ -6,6 +6,7 @@
 #include "G4UnionSolid.hh"
 #include "G4PVPlacement.hh"
 #include "G4LogicalVolume.hh"
+#include "G4Region.hh"
 #include "G4ThreeVector.hh"
 #include "G4VisAttributes.hh"
 #include "G4SubtractionSolid.hh"
@@ -23,6 +24,7 @@ using namespace CLHEP;
 A2DetCherenkov::A2DetCherenkov()
 {
     fIsCheckOverlap=kFALSE;
+    fregionFrame=new G4Region("CherenkovFrame");
 }
 A2DetCherenkov::~A2DetCherenkov()
 {
@@ -52,6 +54,16 @@ G4VPhysicalVolume* A2DetCherenkov::Construct(G4LogicalVolume* MotherLogical){
     //make the Cherenkov detector
     MakeCherenkov();
 
+    //put the steel frame into its own region
+    G4LogicalVolume* frameMothers[2] = { finnerboxvolumeLogic, finnertriLogic };
+    for (G4int i = 0; i < 2; i++){
+        for (G4int j = 0; j < frameMothers[i]->GetNoDaughters(); j++){
+            G4LogicalVolume* lv = frameMothers[i]->GetDaughter(j)->GetLogicalVolume();
+            if (lv->GetMaterial()->GetName() == "G4_STAINLESS-STEEL")
+                fregionFrame->AddRootLogicalVolume(lv);
+        }
+    }
+
     //check for overlaps
     if (fIsCheckOverlap){
         CheckOverlapAndAbort(fAirBoxPhysi, "A2DetCherenkov::Construct()");
@@ -21,6 +21,7 @@ A2DetCrystalBall::A2DetCrystalBall()
 {
   fregionCB=NULL;
   fregionCB=new G4Region("CB");//allows seperate cuts to be defined for crystal
+  fregionCBPassive=new G4Region("CBPassive");//larger cuts for the passive material
 
   fVerbose=1;
   fRot=NULL;
@@ -117,6 +118,13 @@ G4VPhysicalVolume* A2DetCrystalBall::Construct(G4LogicalVolume* MotherLogical)
   if(fGap.z()<1) MakeOther1();
   else if(fGap.z()>1) MakeOther2();
   else {G4cerr<<"Need to specify which other material for the ball."<<G4endl<<"Add line :"<<G4endl<<"/A2/det/setHemiGap 0.4 0.4 1 cm"<<G4endl<<"to DetectorSetup.mac, see manual for details"<<G4endl;exit(0);}
+  //passive material gets its own region for larger cuts
+  if(fTUNLLogic) fregionCBPassive->AddRootLogicalVolume(fTUNLLogic);
+  if(fBTMMLogic) fregionCBPassive->AddRootLogicalVolume(fBTMMLogic);
+  if(fRIMSLogic) fregionCBPassive->AddRootLogicalVolume(fRIMSLogic);
+  for(G4int i=0;i<3;i++)
+    if(fSKILogic[i]) fregionCBPassive->AddRootLogicalVolume(fSKILogic[i]);
+
   //Place the ball in the lab 
    MakeBall();
 
@@ -199,6 +207,7 @@ void A2DetCrystalBall::MakeOther1(){//please read note above
     tun_fill[i] = new G4Tubs("TUNL_FILL", tunl_rout, tunl_rout+(-3.9/(nFill-1)*i+4.)*cm, 5*mm, tunl_add_phlow, tunl_add_phdelta);
     tun_fill_logic[i] = new G4LogicalVolume(tun_fill[i], fNistManager->FindOrBuildMaterial("G4_Fe"),"TUNL_FILL");
     tun_fill_logic[i]->SetVisAttributes(tun_add_att);
+    fregionCBPassive->AddRootLogicalVolume(tun_fill_logic[i]);
     new G4PVPlacement(0, G4ThreeVector(0, fGap.y(), Tshift+tunl_z-(2*tunl_z-5*mm)/(nFill-1)*i), tun_fill_logic[i], "TUNL_FILL", fMotherLogic, false, i);
     new G4PVPlacement(tunl_add_rmat, G4ThreeVector(0, -fGap.y(), Tshift+tunl_z-(2*tunl_z-5*mm)/(nFill-1)*i), tun_fill_logic[i], "TUNL_FILL", fMotherLogic, false, nFill+i);
   }
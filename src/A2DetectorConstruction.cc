@@ -28,6 +28,24 @@
 #include "A2PolarizedTarget.hh"
 #include "A2DetPID.hh"
 #include "A2DetPID3.hh"
+#include "A2RunManager.hh"
+#include "A2Version.hh"
+#include "A2SD.hh"
+#include "A2WCSD.hh"
+#include "A2VisSD.hh"
+
+#include "G4Version.hh"
+#include "G4RegionStore.hh"
+#ifdef WITH_GDML
+#include "G4GDMLParser.hh"
+#endif
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdio>
+#include <unistd.h>
 
 using namespace CLHEP;
 
@@ -78,6 +96,8 @@ A2DetectorConstruction::A2DetectorConstruction(G4String detSet)
   fPizzaZ = A2DetPizza::fgDefaultZPos;
 
   //has to be done here in case use new material for target
+  //(target-only materials are defined on demand, see DefineTargetMaterials())
+  fTargetMaterialsDefined=false;
   DefineMaterials();
 
 }
@@ -103,9 +123,12 @@ G4VPhysicalVolume* A2DetectorConstruction::Construct()
 
   // read the set up file DetectorSetup.mac
   // get the pointer to the User Interface manager 
+  A2RunManager* runManager = A2RunManager::GetA2RunManager();
   G4UImanager* UI = G4UImanager::GetUIpointer();
   G4String command = "/control/execute "+fDetectorSetup;//macros/DetectorSetup.mac";
+  if(runManager) runManager->BeginPhase("detector setup macro");
   UI->ApplyCommand(command);
+  if(runManager) runManager->EndPhase();
   if(fUseCB==0&&fUseTAPS==0&&fUsePID==0&&fUseMWPC==0&&fUseTOF==0&&fUseCherenkov==0&&fUsePizza==0&&fUseTarget==G4String("NO")){
     G4cout<<"G4VPhysicalVolume* A2DetectorConstruction::Construct() Don't seem to be simulating any detectors, please check you are using an appopriate detector setup. I tried the file "<<fDetectorSetup<< " I will exit here before the computer explodes"<<G4endl;
     exit(0);
@@ -118,6 +141,15 @@ G4VPhysicalVolume* A2DetectorConstruction::Construct()
   G4PhysicalVolumeStore::GetInstance()->Clean();
   G4LogicalVolumeStore::GetInstance()->Clean();
   G4SolidStore::GetInstance()->Clean();
+
+  // reload the geometry built by an earlier job with the same setup
+  G4String cacheBase=GetGeometryCacheBase();
+  if(!cacheBase.empty()){
+    if(runManager) runManager->BeginPhase("geometry cache");
+    G4bool loaded=ReadGeometryCache(cacheBase);
+    if(runManager) runManager->EndPhase();
+    if(loaded) return fWorldPhysi;
+  }
   //     
   // World
   //
@@ -156,18 +188,23 @@ G4VPhysicalVolume* A2DetectorConstruction::Construct()
         exit(1);
       }
     }
+    if(runManager) runManager->BeginPhase("Crystal Ball");
     fCrystalBall->Construct(fWorldLogic);
+    if(runManager) runManager->EndPhase();
   }
   if(fUseTAPS){
     G4cout<<"A2DetectorConstruction::Construct() Turn on the taps"<<G4endl;
     G4cout<<"TAPS setup "<<fTAPSSetupFile<<" with "<<fTAPSN<<" crystals, "<<fTAPSZ/cm<<" cm from the target"<<G4endl; 
+    if(runManager) runManager->BeginPhase("TAPS");
     fTAPS=new A2DetTAPS(fTAPSSetupFile,fTAPSN,fNPbWO4,fTAPSZ);
     //fTAPS=new A2DetTAPS();
     fTAPS->SetIsInteractive(fIsInteractive);
     fTAPS->Construct(fWorldLogic);
+    if(runManager) runManager->EndPhase();
   }
   if(fUsePID){
     G4cout<<"A2DetectorConstruction::Construct() Take the pid "<< fUsePID<<G4endl;
+    if(runManager) runManager->BeginPhase("PID");
     if(fUsePID==1)
     {
       fPID=new A2DetPID();
@@ -187,66 +224,58 @@ G4VPhysicalVolume* A2DetectorConstruction::Construct()
       ((A2DetPID3*)fPID)->Construct1(fWorldLogic,fPIDZ);
     }
     else {G4cerr<<"There are 3 possible PIDS, please set UsePID to be 1 (2003) or 2 (available in 2007) or 3 (available in 2016)"<<G4endl; exit(1);}
+    if(runManager) runManager->EndPhase();
   }
 
   if(fUseMWPC){
     G4cout<<"A2DetectorConstruction::Construct() Make the Wire Chambers"<<G4endl;
     if(fUseMWPC==2 || fUseMWPC==20)G4cout<<"With the anode wires created"<<G4endl;
+    if(runManager) runManager->BeginPhase("MWPC");
     fMWPC = new A2DetMWPC();
     if(fUseMWPC==2 || fUseMWPC==20)fMWPC->UseAnodes(true);
     fMWPC ->Construct(fWorldLogic); 
+    if(runManager) runManager->EndPhase();
   }
   if(fUseTOF){
     G4cout<<"A2DetectorConstruction::Construct() ToF time!"<<G4endl;
+    if(runManager) runManager->BeginPhase("TOF");
     fTOF=new A2DetTOF();
     fTOF->ReadParameters(fTOFparFile);
     fTOF->Construct(fWorldLogic);
+    if(runManager) runManager->EndPhase();
   }
   if(fUseCherenkov){
     G4cout<<"A2DetectorConstruction::Construct() Make the Cherenkov"<<G4endl;
     fCherenkov=new A2DetCherenkov();
     fCherenkov->SetIsInteractive(fIsInteractive);
+    if(runManager) runManager->BeginPhase("Cherenkov");
     fCherenkov->Construct(fWorldLogic);
+    if(runManager) runManager->EndPhase();
   }
   if(fUsePizza){
     G4cout<<"A2DetectorConstruction::Construct() Make the Pizza detector "<<fPizzaZ/cm<<" cm from the target"<<G4endl;
     fPizza=new A2DetPizza(fPizzaZ);
     fPizza->SetIsInteractive(fIsInteractive);
+    if(runManager) runManager->BeginPhase("Pizza");
     fPizza->Construct(fWorldLogic);
+    if(runManager) runManager->EndPhase();
   }
   if(fUseTarget!=G4String("NO")){
     G4cout<<"A2DetectorConstruction::Construct() Fill the "<<fUseTarget<<" with "<<fTargetMaterial->GetName()<<G4endl;
-    if(fUseTarget=="Cryo") fTarget=static_cast<A2Target*>(new A2CryoTarget(A2CryoTarget::kCryo1));
-    else if(fUseTarget=="Cryo2") fTarget=static_cast<A2Target*>(new A2CryoTarget(A2CryoTarget::kCryo2));
-    else if(fUseTarget=="CryoHe3") fTarget=static_cast<A2Target*>(new A2CryoTarget(A2CryoTarget::kCryoHe));
-    else if(fUseTarget=="Solid") fTarget=static_cast<A2Target*>(new A2SolidTarget());
-    else if(fUseTarget=="Solid_Generic") fTarget=static_cast<A2Target*>(new A2SolidTargetGeneric());
-    else if(fUseTarget=="Solid_Oct_18") fTarget=static_cast<A2Target*>(new A2SolidTargetGeneric(A2SolidTargetGeneric::kOct_18));
-    else if(fUseTarget=="Solid_Jan_19") fTarget=static_cast<A2Target*>(new A2SolidTargetGeneric(A2SolidTargetGeneric::kJan_19));
-    else if(fUseTarget=="Polarized") fTarget=static_cast<A2Target*>(new A2PolarizedTarget());
-    else{G4cerr<<"A2DetectorConstruction::Construct() Target type does not exist. See DetectorSetup.mac or README"<<G4endl;exit(1);}
-    fTarget->SetMaterial(fTargetMaterial);
-    if (fTargetLength)
-    {
-      G4cout << "A2DetectorConstruction::Construct() Changing target length from default " << fTarget->GetLength() <<
-                 " mm to " << fTargetLength << " mm" << G4endl;
-      fTarget->SetLength(fTargetLength);
-    }
-    if (fTargetRadius)
-    {
-      G4cout << "A2DetectorConstruction::Construct() Changing target radius from default " << fTarget->GetRadius() <<
-                 " mm to " << fTargetRadius << " mm" << G4endl;
-      fTarget->SetRadius(fTargetRadius);
-    }
+    if(runManager) runManager->BeginPhase("target");
+    CreateTarget();
     if(fUseTarget=="Polarized")
     {
       G4cout<<"A2DetectorConstruction::Construct() make the polarised target with "<<fTypeMagneticCoils<<" coils"<<G4endl;
+      if(runManager) runManager->BeginPhase("field map");
       (static_cast<A2PolarizedTarget*>(fTarget))->SetMagneticField(fNameFileFieldMap);
+      if(runManager) runManager->EndPhase();
       (static_cast<A2PolarizedTarget*>(fTarget))->SetMagneticCoils(fTypeMagneticCoils);
     }
     if (fTargetZ)
         G4cout << "A2DetectorConstruction::Construct() Shift the target center by " << fTargetZ << " mm" << G4endl;
     fTarget->Construct(fWorldLogic, fTargetZ);
+    if(runManager) runManager->EndPhase();
   }
   //                                        
   // Visualization attributes
@@ -259,6 +288,8 @@ G4VPhysicalVolume* A2DetectorConstruction::Construct()
 //   G4VisAttributes* beamAtt=new G4VisAttributes(G4Color(0.5,0.5,0.5));
 //   beamAtt->SetForceSolid(true);
 //   BeamLogic->SetVisAttributes(beamAtt);
+
+  if(!cacheBase.empty()) WriteGeometryCache(cacheBase);
   return fWorldPhysi;
 }
 
@@ -266,6 +297,35 @@ G4VPhysicalVolume* A2DetectorConstruction::Construct()
 
 
 
+void A2DetectorConstruction::CreateTarget()
+{
+  //materials of the target structure
+  if(fUseTarget=="Polarized"||fUseTarget.find("Solid_")==0) DefineTargetMaterials();
+  if(fUseTarget=="Cryo") fTarget=static_cast<A2Target*>(new A2CryoTarget(A2CryoTarget::kCryo1));
+  else if(fUseTarget=="Cryo2") fTarget=static_cast<A2Target*>(new A2CryoTarget(A2CryoTarget::kCryo2));
+  else if(fUseTarget=="CryoHe3") fTarget=static_cast<A2Target*>(new A2CryoTarget(A2CryoTarget::kCryoHe));
+  else if(fUseTarget=="Solid") fTarget=static_cast<A2Target*>(new A2SolidTarget());
+  else if(fUseTarget=="Solid_Generic") fTarget=static_cast<A2Target*>(new A2SolidTargetGeneric());
+  else if(fUseTarget=="Solid_Oct_18") fTarget=static_cast<A2Target*>(new A2SolidTargetGeneric(A2SolidTargetGeneric::kOct_18));
+  else if(fUseTarget=="Solid_Jan_19") fTarget=static_cast<A2Target*>(new A2SolidTargetGeneric(A2SolidTargetGeneric::kJan_19));
+  else if(fUseTarget=="Polarized") fTarget=static_cast<A2Target*>(new A2PolarizedTarget());
+  else{G4cerr<<"A2DetectorConstruction::Construct() Target type does not exist. See DetectorSetup.mac or README"<<G4endl;exit(1);}
+  fTarget->SetMaterial(fTargetMaterial);
+  if (fTargetLength)
+  {
+    G4cout << "A2DetectorConstruction::Construct() Changing target length from default " << fTarget->GetLength() <<
+               " mm to " << fTargetLength << " mm" << G4endl;
+    fTarget->SetLength(fTargetLength);
+  }
+  if (fTargetRadius)
+  {
+    G4cout << "A2DetectorConstruction::Construct() Changing target radius from default " << fTarget->GetRadius() <<
+               " mm to " << fTargetRadius << " mm" << G4endl;
+    fTarget->SetRadius(fTargetRadius);
+  }
+}
+
+
 #include "G4RunManager.hh"
 
 void A2DetectorConstruction::UpdateGeometry()
@@ -275,10 +335,18 @@ void A2DetectorConstruction::UpdateGeometry()
 }
 
 
+void A2DetectorConstruction::SetTargetMaterial(G4String mat)
+{
+  //target materials of this class are only defined on demand
+  if(mat.find("A2_")==0 && !G4Material::GetMaterial(mat,false)) DefineTargetMaterials();
+  fTargetMaterial=G4NistManager::Instance()->FindOrBuildMaterial(mat);
+}
+
+
 void A2DetectorConstruction::DefineMaterials()
 { 
-  G4double density,z,a,fractionmass;
-  G4int ncomponents;
+  G4double density,fractionmass;
+  G4int ncomponents,natoms;
 
   //Add materials not contained in default Nist list
   G4NistManager* NistManager=G4NistManager::Instance();
@@ -345,95 +413,18 @@ void A2DetectorConstruction::DefineMaterials()
  brass->AddElement(NistManager->FindOrBuildElement(30),fractionmass=0.38);
  //NistManager->RegisterMaterial(brass);
 
- //Liquid deuterium. From cbsim.
- // NistManager->RegisterMaterial(new G4Material("A2_LD2", z=1., a= 2.014*g/mole, density= 0.162*g/cm3));
- G4Material* A2_lD2 = new G4Material("A2_lD2", z=1., a= 2.014*g/mole, density= 0.162*g/cm3);
- new G4Material("A2_lHe3", z=2., a= 3.0160*g/mole, density= 0.07448*g/cm3); //density of 3He at 2.4 K (average temperature of Nov08)
- new G4Material("A2_lHe4", z=2., a= 4.0026*g/mole, density= 0.125*g/cm3);  // 1050 mBar, 4.24 K
-
  // Birk's constant for plastic scintillators
  G4Material* mat = NistManager->FindOrBuildMaterial("G4_PLASTIC_SC_VINYLTOLUENE");
  const G4double den = 1.023; // density of EJ-204 [g/cm^3]
  G4double kB = 2.07e-2; // NIM B 170 (2000) 523 [g MeV^-1 cm^-2]
  kB /= den; // [cm MeV^-1]
  mat->GetIonisation()->SetBirksConstant(kB*cm/MeV);
-
-//////////
-//Materials for Polarized Target:
-//////////
- 
-  G4String symbol;             
-  G4int iz, n;                 //iz=number of protons  in an isotope; 
-                               // n=number of nucleons in an isotope;
-  G4int natoms;
-  G4double abundance;
-
-//6% helium 3, 94% helium 4 mixture:
- G4Isotope* A2_He3=new G4Isotope("A2_He3", iz=2, n=3, a=3.0160293*g/mole);
- G4Isotope* A2_He4=new G4Isotope("A2_He4", iz=2, n=4, a=4.002602*g/mole);
- G4Element* A2_Hemix=new G4Element("Helium mixture", symbol="A2_Hemix", ncomponents=2);
- A2_Hemix->AddIsotope(A2_He3, abundance=6*perCent);
- A2_Hemix->AddIsotope(A2_He4, abundance=94*perCent);
-
-//Now make Hemix a material so that density can be defined:
-  G4Material* A2_HeMix=new G4Material("A2_HeMix", density=0.14*g/cm3, ncomponents=1);
-  A2_HeMix->AddElement(A2_Hemix, natoms=1);
-
-//Butanol (C4H9OH): (changed density from 0.8 to 0.94. 0.8 probably from normal temp. calculations not reasonable with this value.)
-  G4Material* A2_Butanol=new G4Material("A2_Butanol", density=0.94*g/cm3, ncomponents=3);
-  A2_Butanol->AddElement(NistManager->FindOrBuildElement(6),4);
-  A2_Butanol->AddElement(NistManager->FindOrBuildElement(1),10);
-  A2_Butanol->AddElement(NistManager->FindOrBuildElement(8),1);
-
-//dButanol (C4D9OD):
-  G4Material* A2_DButanol=new G4Material("A2_DButanol", density=1.1*g/cm3, ncomponents=3);
-  A2_DButanol->AddElement(NistManager->FindOrBuildElement(6),fractionmass=0.571);
-  A2_DButanol->AddMaterial(A2_lD2, fractionmass=0.239);
-  A2_DButanol->AddElement(NistManager->FindOrBuildElement(8),fractionmass=0.190);
-
-//60% butanol, 40% helium polarized target material: (changed density from 0.6 to 0.62 due to above mentioned problem.)
-  G4Material* A2_HeButanol=new G4Material("A2_HeButanol", density=0.62*g/cm3, ncomponents=2);
-  A2_HeButanol->AddMaterial(A2_HeMix, fractionmass=0.094);
-  A2_HeButanol->AddMaterial(A2_Butanol, fractionmass=0.906);
-
-//60% dbutanol, 40% helium polarized target material:
-  G4Material* A2_HeDButanol=new G4Material("A2_HeDButanol", density=0.716*g/cm3, ncomponents=2);
-  A2_HeDButanol->AddMaterial(A2_HeMix,    fractionmass=0.078);
-  A2_HeDButanol->AddMaterial(A2_DButanol, fractionmass=0.922);
- 
-//Carbon Foam
-  G4Material* A2_CarbonFoam = new G4Material("A2_CarbonFoam", density=0.57*g/cm3, ncomponents=1);
-  A2_CarbonFoam->AddElement(NistManager->FindOrBuildElement(6), 1);
-
 //Stainless steel (18% Cr, 10% Ni, 72% Fe):
   G4Material* A2_SS=new G4Material("A2_SS", density=8000.*kg/m3, ncomponents=3);
   A2_SS->AddElement(NistManager->FindOrBuildElement(24), fractionmass=0.18);
   A2_SS->AddElement(NistManager->FindOrBuildElement(28), fractionmass=0.10);
   A2_SS->AddElement(NistManager->FindOrBuildElement(26), fractionmass=0.72);//was 25
 
-//NbTi ***don't know density at cold temperature***:
-  G4Material* A2_NbTi=new G4Material("A2_NbTi", density=6.45*g/cm3, ncomponents=2);
-  A2_NbTi->AddElement(NistManager->FindOrBuildElement(22), 0.47);
-  A2_NbTi->AddElement(NistManager->FindOrBuildElement(41), 0.53);
-
-//Epoxy resin (C21H25Cl05) ***not certain if correct chemical formula or density for colder temperature***:
-  G4Material* A2_Resin=new G4Material("A2_Resin", density=1.15*g/cm3, ncomponents=4);
-  A2_Resin->AddElement(NistManager->FindOrBuildElement(6), 21);
-  A2_Resin->AddElement(NistManager->FindOrBuildElement(1), 25);
-  A2_Resin->AddElement(NistManager->FindOrBuildElement(17), 1);
-  A2_Resin->AddElement(NistManager->FindOrBuildElement(8), 5);
-
-//Amine Hardener (C8H18N2) ***not certain if correct chemical formula or density for colder temperature***:
-  G4Material* A2_13BAC=new G4Material("A2_13BAC", density=0.94*g/cm3, ncomponents=3);
-  A2_13BAC->AddElement(NistManager->FindOrBuildElement(6), 8);
-  A2_13BAC->AddElement(NistManager->FindOrBuildElement(1), 18);
-  A2_13BAC->AddElement(NistManager->FindOrBuildElement(7), 2);
-
-//Epoxy adhesive with mix ratio 100:25 parts by weight resin/hardener ***don't know density at cold temperature***:
-  G4Material* A2_Epoxy=new G4Material("A2_Epoxy", density=1.2*g/cm3, ncomponents=2);
-  A2_Epoxy->AddMaterial(A2_Resin, fractionmass=0.8);
-  A2_Epoxy->AddMaterial(A2_13BAC, fractionmass=0.2);
-
 //Tedlar for Cherenkov windows (C2H3F)
   G4Material* A2_Tedlar= new G4Material("A2_Tedlar", density= 1.397*g/cm3, ncomponents=3);
   A2_Tedlar->AddElement(NistManager->FindOrBuildElement(6), 2);
@@ -473,38 +464,6 @@ void A2DetectorConstruction::DefineMaterials()
   A2_Acrylic->AddElement(NistManager->FindOrBuildElement(1), 8);
   A2_Acrylic->AddElement(NistManager->FindOrBuildElement(8), 2);
 
-  //
-  // Solid targets
-  //
-
-  G4Isotope* iso_Ca40 = new G4Isotope("A2_NS_Iso_Ca40", 20, 40, 39.962591*g/mole);
-  G4Isotope* iso_Ca48 = new G4Isotope("A2_NS_Iso_Ca48", 20, 48, 47.952523*g/mole);
-  G4Isotope* iso_Pb208 = new G4Isotope("A2_NS_Iso_Pb208", 82, 208, 207.976651*g/mole);
-  G4Element* elem_Ca48 = new G4Element("A2_NS_Elem_Ca48", "A2_NS_Elem_Ca48", 2);
-  elem_Ca48->AddIsotope(iso_Ca40, 0.085);
-  elem_Ca48->AddIsotope(iso_Ca48, 0.915);
-  G4Element* elem_Pb208 = new G4Element("A2_NS_Elem_Pb208", "A2_NS_Elem_Pb208", 1);
-  elem_Pb208->AddIsotope(iso_Pb208, 1.);
-  G4Material* mat_Ca48 = new G4Material("A2_NS_Ca48", 1.82975*g/cm3, 1);
-  mat_Ca48->AddElement(elem_Ca48, 1.);
-  G4Material* mat_Pb208 = new G4Material("A2_NS_Pb208", 11.382*g/cm3, 1);
-  mat_Pb208->AddElement(elem_Pb208, 1.);
-
-  // Extruded Polystyrene
-  G4Material* A2_XPS = new G4Material("A2_XPS", 0.03333*g/cm3, 2);
-  A2_XPS->AddElement(NistManager->FindOrBuildElement(6), 8);
-  A2_XPS->AddElement(NistManager->FindOrBuildElement(1), 8);
-
-  // Polypropylen
-  G4Material* A2_POLYPROPYLENE = new G4Material("A2_POLYPROPYLEN", 0.9*g/cm3, 2);
-  A2_POLYPROPYLENE->AddElement(NistManager->FindOrBuildElement(6), 3);
-  A2_POLYPROPYLENE->AddElement(NistManager->FindOrBuildElement(1), 6);
-
-  // Carbon fiber reinforced plastic
-  G4Material* A2_CFRP = new G4Material("A2_CFRP", 1.6*g/cm3, 2);
-  A2_CFRP->AddElement(NistManager->FindOrBuildElement(6), fractionmass=0.95);
-  A2_CFRP->AddMaterial(A2_Epoxy, fractionmass=0.05);
-
   /*Now useG4NistManager
  //This function illustrates the possible ways to define materials
  
@@ -676,3 +635,371 @@ fMaterialDefault  = Vacuum;
   */
 }
 
+void A2DetectorConstruction::DefineTargetMaterials()
+{
+  //Materials of the cryo, polarized and solid targets. Only defined if
+  //needed as every element in the element table adds to the size of
+  //the (neutron) physics tables.
+  if(fTargetMaterialsDefined) return;
+  fTargetMaterialsDefined=true;
+
+  G4double density,z,a,fractionmass;
+  G4int ncomponents,natoms;
+
+  G4NistManager* NistManager=G4NistManager::Instance();
+
+ //Liquid deuterium. From cbsim.
+ // NistManager->RegisterMaterial(new G4Material("A2_LD2", z=1., a= 2.014*g/mole, density= 0.162*g/cm3));
+ G4Material* A2_lD2 = new G4Material("A2_lD2", z=1., a= 2.014*g/mole, density= 0.162*g/cm3);
+ new G4Material("A2_lHe3", z=2., a= 3.0160*g/mole, density= 0.07448*g/cm3); //density of 3He at 2.4 K (average temperature of Nov08)
+ new G4Material("A2_lHe4", z=2., a= 4.0026*g/mole, density= 0.125*g/cm3);  // 1050 mBar, 4.24 K
+
+//////////
+//Materials for Polarized Target:
+//////////
+ 
+  G4String symbol;             
+  G4int iz, n;                 //iz=number of protons  in an isotope; 
+                               // n=number of nucleons in an isotope;
+  G4double abundance;
+
+//6% helium 3, 94% helium 4 mixture:
+ G4Isotope* A2_He3=new G4Isotope("A2_He3", iz=2, n=3, a=3.0160293*g/mole);
+ G4Isotope* A2_He4=new G4Isotope("A2_He4", iz=2, n=4, a=4.002602*g/mole);
+ G4Element* A2_Hemix=new G4Element("Helium mixture", symbol="A2_Hemix", ncomponents=2);
+ A2_Hemix->AddIsotope(A2_He3, abundance=6*perCent);
+ A2_Hemix->AddIsotope(A2_He4, abundance=94*perCent);
+
+//Now make Hemix a material so that density can be defined:
+  G4Material* A2_HeMix=new G4Material("A2_HeMix", density=0.14*g/cm3, ncomponents=1);
+  A2_HeMix->AddElement(A2_Hemix, natoms=1);
+
+//Butanol (C4H9OH): (changed density from 0.8 to 0.94. 0.8 probably from normal temp. calculations not reasonable with this value.)
+  G4Material* A2_Butanol=new G4Material("A2_Butanol", density=0.94*g/cm3, ncomponents=3);
+  A2_Butanol->AddElement(NistManager->FindOrBuildElement(6),4);
+  A2_Butanol->AddElement(NistManager->FindOrBuildElement(1),10);
+  A2_Butanol->AddElement(NistManager->FindOrBuildElement(8),1);
+
+//dButanol (C4D9OD):
+  G4Material* A2_DButanol=new G4Material("A2_DButanol", density=1.1*g/cm3, ncomponents=3);
+  A2_DButanol->AddElement(NistManager->FindOrBuildElement(6),fractionmass=0.571);
+  A2_DButanol->AddMaterial(A2_lD2, fractionmass=0.239);
+  A2_DButanol->AddElement(NistManager->FindOrBuildElement(8),fractionmass=0.190);
+
+//60% butanol, 40% helium polarized target material: (changed density from 0.6 to 0.62 due to above mentioned problem.)
+  G4Material* A2_HeButanol=new G4Material("A2_HeButanol", density=0.62*g/cm3, ncomponents=2);
+  A2_HeButanol->AddMaterial(A2_HeMix, fractionmass=0.094);
+  A2_HeButanol->AddMaterial(A2_Butanol, fractionmass=0.906);
+
+//60% dbutanol, 40% helium polarized target material:
+  G4Material* A2_HeDButanol=new G4Material("A2_HeDButanol", density=0.716*g/cm3, ncomponents=2);
+  A2_HeDButanol->AddMaterial(A2_HeMix,    fractionmass=0.078);
+  A2_HeDButanol->AddMaterial(A2_DButanol, fractionmass=0.922);
+ 
+//Carbon Foam
+  G4Material* A2_CarbonFoam = new G4Material("A2_CarbonFoam", density=0.57*g/cm3, ncomponents=1);
+  A2_CarbonFoam->AddElement(NistManager->FindOrBuildElement(6), 1);
+
+//NbTi ***don't know density at cold temperature***:
+  G4Material* A2_NbTi=new G4Material("A2_NbTi", density=6.45*g/cm3, ncomponents=2);
+  A2_NbTi->AddElement(NistManager->FindOrBuildElement(22), 0.47);
+  A2_NbTi->AddElement(NistManager->FindOrBuildElement(41), 0.53);
+
+//Epoxy resin (C21H25Cl05) ***not certain if correct chemical formula or density for colder temperature***:
+  G4Material* A2_Resin=new G4Material("A2_Resin", density=1.15*g/cm3, ncomponents=4);
+  A2_Resin->AddElement(NistManager->FindOrBuildElement(6), 21);
+  A2_Resin->AddElement(NistManager->FindOrBuildElement(1), 25);
+  A2_Resin->AddElement(NistManager->FindOrBuildElement(17), 1);
+  A2_Resin->AddElement(NistManager->FindOrBuildElement(8), 5);
+
+//Amine Hardener (C8H18N2) ***not certain if correct chemical formula or density for colder temperature***:
+  G4Material* A2_13BAC=new G4Material("A2_13BAC", density=0.94*g/cm3, ncomponents=3);
+  A2_13BAC->AddElement(NistManager->FindOrBuildElement(6), 8);
+  A2_13BAC->AddElement(NistManager->FindOrBuildElement(1), 18);
+  A2_13BAC->AddElement(NistManager->FindOrBuildElement(7), 2);
+
+//Epoxy adhesive with mix ratio 100:25 parts by weight resin/hardener ***don't know density at cold temperature***:
+  G4Material* A2_Epoxy=new G4Material("A2_Epoxy", density=1.2*g/cm3, ncomponents=2);
+  A2_Epoxy->AddMaterial(A2_Resin, fractionmass=0.8);
+  A2_Epoxy->AddMaterial(A2_13BAC, fractionmass=0.2);
+
+  //
+  // Solid targets
+  //
+
+  G4Isotope* iso_Ca40 = new G4Isotope("A2_NS_Iso_Ca40", 20, 40, 39.962591*g/mole);
+  G4Isotope* iso_Ca48 = new G4Isotope("A2_NS_Iso_Ca48", 20, 48, 47.952523*g/mole);
+  G4Isotope* iso_Pb208 = new G4Isotope("A2_NS_Iso_Pb208", 82, 208, 207.976651*g/mole);
+  G4Element* elem_Ca48 = new G4Element("A2_NS_Elem_Ca48", "A2_NS_Elem_Ca48", 2);
+  elem_Ca48->AddIsotope(iso_Ca40, 0.085);
+  elem_Ca48->AddIsotope(iso_Ca48, 0.915);
+  G4Element* elem_Pb208 = new G4Element("A2_NS_Elem_Pb208", "A2_NS_Elem_Pb208", 1);
+  elem_Pb208->AddIsotope(iso_Pb208, 1.);
+  G4Material* mat_Ca48 = new G4Material("A2_NS_Ca48", 1.82975*g/cm3, 1);
+  mat_Ca48->AddElement(elem_Ca48, 1.);
+  G4Material* mat_Pb208 = new G4Material("A2_NS_Pb208", 11.382*g/cm3, 1);
+  mat_Pb208->AddElement(elem_Pb208, 1.);
+
+  // Extruded Polystyrene
+  G4Material* A2_XPS = new G4Material("A2_XPS", 0.03333*g/cm3, 2);
+  A2_XPS->AddElement(NistManager->FindOrBuildElement(6), 8);
+  A2_XPS->AddElement(NistManager->FindOrBuildElement(1), 8);
+
+  // Polypropylen
+  G4Material* A2_POLYPROPYLENE = new G4Material("A2_POLYPROPYLEN", 0.9*g/cm3, 2);
+  A2_POLYPROPYLENE->AddElement(NistManager->FindOrBuildElement(6), 3);
+  A2_POLYPROPYLENE->AddElement(NistManager->FindOrBuildElement(1), 6);
+
+  // Carbon fiber reinforced plastic
+  G4Material* A2_CFRP = new G4Material("A2_CFRP", 1.6*g/cm3, 2);
+  A2_CFRP->AddElement(NistManager->FindOrBuildElement(6), fractionmass=0.95);
+  A2_CFRP->AddMaterial(A2_Epoxy, fractionmass=0.05);
+}
+
+
+G4String A2DetectorConstruction::GetGeometryCacheBase()
+{
+  //Return the path of the geometry cache entry (without extension) for the
+  //current setup or an empty string if the cache is not used. The entry is
+  //named after the hash of the setup macro, the data files, the detector
+  //sources and the settings.
+  A2RunManager* runManager=A2RunManager::GetA2RunManager();
+  if(!runManager||runManager->GetGeometryCacheDir().empty()) return G4String();
+#ifndef WITH_GDML
+  G4cout<<"A2DetectorConstruction::GetGeometryCacheBase() Geometry cache needs Geant4 with GDML support, building the geometry"<<G4endl;
+  return G4String();
+#else
+  //vis attributes and the magnetic field are not stored
+  if(fIsInteractive){
+    G4cout<<"A2DetectorConstruction::GetGeometryCacheBase() Geometry cache is only used in batch mode"<<G4endl;
+    return G4String();
+  }
+  if(fUseTarget=="Polarized"){
+    G4cout<<"A2DetectorConstruction::GetGeometryCacheBase() Geometry cache does not support the polarized target (field), building the geometry"<<G4endl;
+    return G4String();
+  }
+
+  std::ostringstream key;
+  key<<std::setprecision(10);
+  key<<A2_VERSION<<" "<<A2_SOURCE_ID<<"\n"<<G4Version<<"\n";
+  key<<"CB "<<fUseCB<<" "<<fHemiGap<<" "<<fCBCrystGeometry<<"\n";
+  key<<"TAPS "<<fUseTAPS<<" "<<fTAPSSetupFile<<" "<<fTAPSN<<" "<<fTAPSZ<<" "<<fNPbWO4<<"\n";
+  key<<"PID "<<fUsePID<<" "<<fPIDZ<<" "<<fPIDRotation<<"\n";
+  key<<"MWPC "<<fUseMWPC<<"\n";
+  key<<"TOF "<<fUseTOF<<" "<<fTOFparFile<<"\n";
+  key<<"Cherenkov "<<fUseCherenkov<<"\n";
+  key<<"Pizza "<<fUsePizza<<" "<<fPizzaZ<<"\n";
+  key<<"target "<<fUseTarget;
+  if(fUseTarget!=G4String("NO")) key<<" "<<fTargetMaterial->GetName()<<" "<<fTargetLength<<" "<<fTargetRadius<<" "<<fTargetZ;
+  key<<"\n";
+
+  //contents of the setup macro and the data files
+  std::vector<G4String> files;
+  files.push_back(fDetectorSetup);
+  if(fUseCB) files.push_back("data/CrystalConvert.in");
+  if(fUseTAPS) files.push_back(fTAPSSetupFile);
+  if(fUseTOF) files.push_back(fTOFparFile);
+  for(size_t i=0;i<files.size();i++){
+    std::ifstream in(files[i]);
+    std::stringstream buf;
+    if(in.good()) buf<<in.rdbuf();
+    key<<"file "<<files[i]<<"\n"<<buf.str()<<"\n";
+  }
+
+  fGeometryKey=key.str();
+  return runManager->GetGeometryCacheDir()+"/"+A2RunManager::Hash(fGeometryKey);
+#endif
+}
+
+
+G4bool A2DetectorConstruction::ReadGeometryCache(const G4String& base)
+{
+  //Read the geometry from the cache entry 'base' (GDML file and a text file
+  //with the key and the derived settings), restore the sensitive detectors,
+  //regions and the target parameters. Return false if the entry does not
+  //exist or does not match.
+#ifdef WITH_GDML
+  //sidecar: key, separator, derived settings (written last)
+  std::ifstream in(base+".txt");
+  if(!in.good()){
+    G4cout<<"A2DetectorConstruction::ReadGeometryCache() No cached geometry "<<base<<", building it"<<G4endl;
+    return false;
+  }
+  std::stringstream content;
+  content<<in.rdbuf();
+  G4String text=content.str();
+  size_t sep=text.rfind("----\n");
+  if(sep==std::string::npos||text.substr(0,sep)!=fGeometryKey){
+    G4cout<<"A2DetectorConstruction::ReadGeometryCache() Key mismatch of the cached geometry "<<base<<", building it"<<G4endl;
+    return false;
+  }
+  G4double targetZ=0,targetLength=0,targetRadius=0;
+  std::istringstream settings(text.substr(sep+5));
+  G4String line;
+  while(std::getline(settings,line)){
+    std::istringstream iss(line);
+    G4String tag;
+    iss>>tag;
+    if(tag=="target") iss>>targetZ>>targetLength>>targetRadius;
+    else if(tag=="material"){
+      //build the NIST materials before the GDML copies, see below
+      G4String name;
+      iss>>name;
+      G4NistManager::Instance()->FindOrBuildMaterial(name);
+    }
+  }
+
+  //target materials have to exist before the GDML copies, too
+  if(fUseTarget!=G4String("NO")) CreateTarget();
+
+  G4cout<<"A2DetectorConstruction::ReadGeometryCache() Reading the cached geometry "<<base<<".gdml"<<G4endl;
+  G4GDMLParser parser;
+  parser.Read(base+".gdml",false);
+  fWorldPhysi=parser.GetWorldVolume();
+  if(!fWorldPhysi){
+    G4cerr<<"A2DetectorConstruction::ReadGeometryCache() Could not read "<<base<<".gdml, please remove the cache entry"<<G4endl;
+    exit(1);
+  }
+  fWorldLogic=fWorldPhysi->GetLogicalVolume();
+
+  //use the materials of this class and NIST (e.g. with Birks constants)
+  //instead of the copies read from GDML, the originals come first in the table
+  const G4MaterialTable* materials=G4Material::GetMaterialTable();
+  G4LogicalVolumeStore* volumes=G4LogicalVolumeStore::GetInstance();
+  for(size_t i=0;i<volumes->size();i++){
+    G4LogicalVolume* lv=(*volumes)[i];
+    for(size_t j=0;j<materials->size();j++){
+      if((*materials)[j]->GetName()==lv->GetMaterial()->GetName()){
+        lv->SetMaterial((*materials)[j]);
+        break;
+      }
+    }
+  }
+
+  //sensitive detectors and regions
+  G4SDManager* SDman=G4SDManager::GetSDMpointer();
+  const G4GDMLAuxMapType* auxmap=parser.GetAuxMap();
+  for(G4GDMLAuxMapType::const_iterator it=auxmap->begin();it!=auxmap->end();++it){
+    for(size_t i=0;i<it->second.size();i++){
+      const G4GDMLAuxStructType& aux=it->second[i];
+      std::istringstream iss(aux.value);
+      if(aux.type=="SensDet"){
+        G4String type,name;
+        G4int n=0;
+        iss>>type>>name>>n;
+        G4VSensitiveDetector* sd=SDman->FindSensitiveDetector(name,false);
+        if(!sd){
+          if(type=="A2SD") sd=new A2SD(name,n);
+          else if(type=="A2WCSD") sd=new A2WCSD(name,n);
+          else if(type=="A2VisSD") sd=new A2VisSD(name,n);
+          else{G4cerr<<"A2DetectorConstruction::ReadGeometryCache() Unknown sensitive detector type "<<type<<G4endl;exit(1);}
+          SDman->AddNewDetector(sd);
+        }
+        it->first->SetSensitiveDetector(sd);
+      }
+      else if(aux.type=="Region"){
+        G4Region* region=G4RegionStore::GetInstance()->GetRegion(aux.value,false);
+        if(!region) region=new G4Region(aux.value);
+        region->AddRootLogicalVolume(it->first);
+      }
+    }
+  }
+
+  //settings of the detectors and target used by the other classes
+  if(fUseTOF){
+    fTOF=new A2DetTOF();
+    fTOF->ReadParameters(fTOFparFile);
+  }
+  if(fUseTarget!=G4String("NO")){
+    fTarget->SetLength(targetLength);
+    fTarget->SetRadius(targetRadius);
+    fTarget->SetCenter(G4ThreeVector(0,0,targetZ));
+  }
+  fWorldLogic->SetVisAttributes(G4VisAttributes::Invisible);
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+void A2DetectorConstruction::WriteGeometryCache(const G4String& base)
+{
+  //Write the constructed geometry to the cache entry 'base'. Sensitive
+  //detectors and region roots are stored as GDML auxiliary information.
+  //Both files are written to temporary files which are renamed, the
+  //text file last, so that concurrent jobs never read incomplete entries.
+#ifdef WITH_GDML
+  G4GDMLParser parser;
+#if G4VERSION_NUMBER >= 1020
+  parser.SetRegionExport(false);
+#endif
+
+  std::ostringstream settings;
+  settings<<std::setprecision(10);
+  G4LogicalVolumeStore* volumes=G4LogicalVolumeStore::GetInstance();
+  std::vector<G4String> nist;
+  for(size_t i=0;i<volumes->size();i++){
+    G4LogicalVolume* lv=(*volumes)[i];
+    G4String mat=lv->GetMaterial()->GetName();
+    if(mat.find("G4_")==0&&std::find(nist.begin(),nist.end(),mat)==nist.end()){
+      nist.push_back(mat);
+      settings<<"material "<<mat<<"\n";
+    }
+    G4VSensitiveDetector* sd=lv->GetSensitiveDetector();
+    if(!sd) continue;
+    std::ostringstream value;
+    if(dynamic_cast<A2SD*>(sd)) value<<"A2SD "<<sd->GetName()<<" "<<((A2SD*)sd)->GetNelements();
+    else if(dynamic_cast<A2WCSD*>(sd)) value<<"A2WCSD "<<sd->GetName()<<" "<<((A2WCSD*)sd)->GetNelements();
+    else if(dynamic_cast<A2VisSD*>(sd)) value<<"A2VisSD "<<sd->GetName()<<" "<<((A2VisSD*)sd)->GetNelements();
+    else{
+      G4cout<<"A2DetectorConstruction::WriteGeometryCache() Unknown sensitive detector "<<sd->GetName()<<", geometry not cached"<<G4endl;
+      return;
+    }
+    G4GDMLAuxStructType aux;
+    aux.type="SensDet";
+    aux.value=value.str();
+    aux.unit="";
+    aux.auxList=0;
+    parser.AddVolumeAuxiliary(aux,lv);
+  }
+  G4RegionStore* regions=G4RegionStore::GetInstance();
+  for(size_t i=0;i<regions->size();i++){
+    G4Region* region=(*regions)[i];
+    if(region->GetName()=="DefaultRegionForTheWorld"||region->GetName()=="DefaultRegionForParallelWorld") continue;
+    std::vector<G4LogicalVolume*>::iterator it=region->GetRootLogicalVolumeIterator();
+    for(size_t j=0;j<region->GetNumberOfRootVolumes();j++,it++){
+      G4GDMLAuxStructType aux;
+      aux.type="Region";
+      aux.value=region->GetName();
+      aux.unit="";
+      aux.auxList=0;
+      parser.AddVolumeAuxiliary(aux,*it);
+    }
+  }
+  if(fTarget) settings<<"target "<<fTarget->GetCenter().z()<<" "<<fTarget->GetLength()<<" "<<fTarget->GetRadius()<<"\n";
+
+  //write
+  A2RunManager* runManager=A2RunManager::GetA2RunManager();
+  if(!A2RunManager::MakeDir(runManager->GetGeometryCacheDir())){
+    G4cout<<"A2DetectorConstruction::WriteGeometryCache() Could not create the directory "<<runManager->GetGeometryCacheDir()<<G4endl;
+    return;
+  }
+  std::ostringstream tmp;
+  tmp<<base<<".tmp"<<getpid();
+  parser.Write(tmp.str()+".gdml",fWorldPhysi,true);
+  {
+    std::ofstream out(tmp.str()+".txt");
+    out<<fGeometryKey<<"----\n"<<settings.str();
+  }
+  if(std::rename((tmp.str()+".gdml").c_str(),(base+".gdml").c_str())||
+     std::rename((tmp.str()+".txt").c_str(),(base+".txt").c_str())){
+    G4cout<<"A2DetectorConstruction::WriteGeometryCache() Could not write the cached geometry "<<base<<G4endl;
+    std::remove((tmp.str()+".gdml").c_str());
+    std::remove((tmp.str()+".txt").c_str());
+    return;
+  }
+  G4cout<<"A2DetectorConstruction::WriteGeometryCache() Stored the geometry in "<<base<<".gdml"<<G4endl;
+#endif
+}
@@ -7,6 +7,12 @@
 #include "A2EventActionMessenger.hh"
 #include "A2Version.hh"
 #include "A2FileGenerator.hh"
+#include "A2PrimaryBiasing.hh"
+#include "A2AcceptanceFilter.hh"
+#include "A2Profiler.hh"
+#include "A2StackingAction.hh"
+#include "A2Watchdog.hh"
+#include "A2Metrics.hh"
 
 #include "G4Event.hh"
 #include "G4TrajectoryContainer.hh"
@@ -15,6 +21,7 @@
 #include "G4UnitsTable.hh"
 #include "G4Trajectory.hh"
 #include "G4UImanager.hh"
+#include "G4RunManager.hh"
 #include "CLHEP/Units/SystemOfUnits.h"
 #include "G4Version.hh"
 
@@ -22,9 +29,11 @@
 #include "TString.h"
 #include "TSystem.h"
 #include "TStopwatch.h"
+#include "TNamed.h"
 #include <iomanip>
 #include <sys/utsname.h>
 #include <fstream>
+#include <sstream>
 
 using namespace CLHEP;
 
@@ -49,9 +58,20 @@ A2EventAction::A2EventAction(A2RunAction* run, A2PrimaryGeneratorAction* pga,
 
   fprintModulo=1000;
   fTimer = new TStopwatch();
+  fInputBytes0 = 0;
   fCBOut=NULL;
   fOverwriteFile=false;
   fStorePrimaries=true;
+  fStoreEventStats=false;
+  fNSteps=0;
+  fCPUStart=0;
+  fCheckpoint=0;
+  fNextCheckpoint=0;
+  fResume=false;
+  fResumeComplete=false;
+  fResumeEntries=-1;
+  fResumeInput=0;
+  fEventsDone0=0;
   for (int i = 0; i < argc; i++)
   {
     fInvokeCmd += argv[i];
@@ -73,17 +93,38 @@ A2EventAction::~A2EventAction()
 
 void A2EventAction::BeginOfEventAction(const G4Event* evt)
 {
-  if (evt->GetEventID() == 0) fTimer->Start();
+  if (evt->GetEventID() == 0) fNextCheckpoint = fCheckpoint;
   if (fPGA->GetMode() == EPGA_FILE && evt->GetEventID() == fReqEvents - 1)
   {
     FormatTimeSec(fTimer->RealTime(), fDuration);
     G4cout << TString::Format("Total tracking time: %s", fDuration.Data()) << G4endl;
   }
+  if (frunAct->GetWatchdog()->IsEnabled()) frunAct->GetWatchdog()->BeginOfEvent(evt);
+
+  // per-event cost statistics
+  fNSteps = 0;
+  fCPUStart = std::clock();
 }
 
 
 void A2EventAction::EndOfEventAction(const G4Event* evt)
 {
+  // record events aborted by the watchdog
+  if (frunAct->GetWatchdog()->IsEnabled())
+    frunAct->GetWatchdog()->EndOfEvent(evt, fPGA->GetInputEntry());
+
+  // flush the output and save the position for a resume, also after aborted
+  // events so that a checkpoint is not skipped
+  G4bool checkpoint = fCheckpoint > 0 && evt->GetEventID() + 1 >= fNextCheckpoint;
+  if (checkpoint) fNextCheckpoint = evt->GetEventID() + 1 + fCheckpoint;
+
+  // skip aborted events (e.g. end of streamed input)
+  if (evt->IsAborted())
+  {
+    if (checkpoint) WriteCheckpoint(evt);
+    return;
+  }
+
   G4int evtNb = evt->GetEventID();
   if (evtNb && evtNb % fprintModulo == 0)
   {
@@ -91,7 +132,7 @@ void A2EventAction::EndOfEventAction(const G4Event* evt)
     fEventRate = evtNb / fTimer->RealTime();
     fTimer->Continue();
     G4cout << TString::Format("%7d events tracked (%.2f events/s)", evtNb, fEventRate);
-    if (fPGA->GetMode() == EPGA_FILE)
+    if (fPGA->GetMode() == EPGA_FILE && fReqEvents > 0)
     {
       TString timeFmt;
       FormatTimeSec((fReqEvents - evtNb) / (Double_t)fEventRate, timeFmt);
@@ -110,6 +151,12 @@ void A2EventAction::EndOfEventAction(const G4Event* evt)
   //write to the output ntuple if it exists
   //if not need to set file via /A2/event/setOutputFile XXX.root
   if(fCBOut){
+    if(fStoreEventStats){
+      const A2StackingAction* stackingAction = static_cast<const A2StackingAction*>(G4RunManager::GetRunManager()->GetUserStackingAction());
+      fCBOut->SetEventStats(1000.*(std::clock() - fCPUStart)/CLOCKS_PER_SEC, fNSteps,
+                            stackingAction ? stackingAction->GetNSecondaries() : 0,
+                            stackingAction ? stackingAction->GetMaxStackDepth() : 0);
+    }
     fCBOut->WriteHit(HCE);
     fCBOut->WriteGenInput();
     fCBOut->GetTree()->Fill();
@@ -143,6 +190,11 @@ void A2EventAction::EndOfEventAction(const G4Event* evt)
       }
     }
   } 
+  if(checkpoint) WriteCheckpoint(evt);
+
+  //live metrics for the batch monitoring
+  if(frunAct->GetMetrics()->IsEnabled())
+    frunAct->GetMetrics()->EndOfEvent(fNSteps, fOutFile);
   
 
 
@@ -204,8 +256,16 @@ G4int A2EventAction::PrepareOutput(){
     G4cout<<"/A2/event/SetOutputFile XXX.root"<<G4endl;
     return 0;
   }
+  //resume: continue the output of the checkpoint (start it again if there is none)
+  if(fResume){
+    fOutFile=new TFile(fOutFileName,fResumeEntries>=0 ? "UPDATE" : "RECREATE");
+    if(!fOutFile->IsOpen()){
+      G4cerr<<"A2EventAction::PrepareOutput() Could not reopen "<<fOutFileName<<" to resume"<<G4endl;
+      exit(1);
+    }
+  }
   //if filename try to open the file
-  fOutFile=new TFile(fOutFileName,"CREATE");
+  else fOutFile=new TFile(fOutFileName,"CREATE");
   //if file aready exists make a new name by adding XXXA2copy#.root
   while (!fOutFile->IsOpen()){
     int pos1=fOutFileName.Index("A2copy");
@@ -255,13 +315,25 @@ G4int A2EventAction::PrepareOutput(){
   //Create output tree
   //This is curently made in the same format as the cbsim output
   fCBOut=new A2CBOutput();
+  if(fResume&&fResumeEntries>=0){
+    TTree* tree=(TTree*)fOutFile->Get("h12");
+    if(!tree||tree->GetEntries()!=fResumeEntries){
+      G4cerr<<"A2EventAction::PrepareOutput() Tree h12 of "<<fOutFileName<<" does not match its checkpoint ("
+            <<(tree ? tree->GetEntries() : 0)<<" instead of "<<fResumeEntries<<" entries)"<<G4endl;
+      exit(1);
+    }
+    G4cout<<"A2EventAction::PrepareOutput() Appending to "<<fResumeEntries<<" entries of the checkpoint"<<G4endl;
+    fCBOut->AttachTree(tree);
+  }
   fCBOut->SetFile(fOutFile);
   fCBOut->SetStorePrimaries(fStorePrimaries);
+  fCBOut->SetStoreEventStats(fStoreEventStats);
   fCBOut->SetBranches();
   return 1;
 }
 void  A2EventAction::CloseOutput(){
   if(!fCBOut) return;
+  G4int nEvents = fCBOut->GetTree()->GetEntries();
   fCBOut->WriteTree();
   delete fCBOut;
 
@@ -287,6 +359,15 @@ void  A2EventAction::CloseOutput(){
   TString inputFile("none");
   if (fPGA->GetFileGen())
     inputFile = fPGA->GetFileGen()->GetFileName().c_str();
+  // number of events unknown in advance (streamed input)
+  G4int trackedEvents = fReqEvents;
+  if (trackedEvents <= 0)
+  {
+    Double_t t = fTimer->RealTime();
+    FormatTimeSec(t, fDuration);
+    trackedEvents = nEvents;
+    if (t > 0) fEventRate = nEvents / t;
+  }
   TString trackedPart("unknown");
   if (fPGA->GetFileGen())
   {
@@ -295,6 +376,12 @@ void  A2EventAction::CloseOutput(){
       trackedPart = "all stable (Pluto cocktail)";
     else if (fPGA->GetFileGen()->GetType() == A2FileGenerator::kGiBUU)
       trackedPart = "all (GiBUU)";
+    else if (fPGA->GetFileGen()->GetType() == A2FileGenerator::kHepMC)
+      trackedPart = "all final-state (HepMC)";
+    else if (fPGA->GetFileGen()->GetType() == A2FileGenerator::kLHEF)
+      trackedPart = "all outgoing (LHEF)";
+    else if (fPGA->GetFileGen()->GetType() == A2FileGenerator::kBinary)
+      trackedPart = "all (binary stream)";
     else
     {
       for (G4int i = 0; i < fPGA->GetFileGen()->GetNParticles(); i++)
@@ -309,6 +396,29 @@ void  A2EventAction::CloseOutput(){
     }
   }
 
+  TString biasing("none");
+  if (fPGA->GetBiasing()->IsActive())
+    biasing = TString::Format("importance sampling, %ld of %ld events rejected",
+                              fPGA->GetBiasing()->GetNRejected(),
+                              fPGA->GetBiasing()->GetNEvents());
+
+  TString acceptance("none");
+  if (fPGA->GetAcceptanceFilter()->IsActive())
+    acceptance = TString::Format("%s, %ld of %ld events outside, %ld rejected",
+                                 fPGA->GetAcceptanceFilter()->GetModeName(),
+                                 fPGA->GetAcceptanceFilter()->GetNOutside(),
+                                 fPGA->GetAcceptanceFilter()->GetNEvents(),
+                                 fPGA->GetAcceptanceFilter()->GetNRejected());
+
+  TString stacking("none");
+  const A2StackingAction* stackingAction = static_cast<const A2StackingAction*>(G4RunManager::GetRunManager()->GetUserStackingAction());
+  if (stackingAction)
+    stacking = stackingAction->GetSummary().c_str();
+
+  TString watchdog("disabled");
+  if (frunAct->GetWatchdog()->IsEnabled())
+    watchdog = TString::Format("%d events aborted", frunAct->GetWatchdog()->GetNAborted());
+
   TNamed meta("A2Geant4 Metadata", TString::Format("\n"
               "       Version            : %s\n"
               "       Geant4 Version     : %s\n"
@@ -324,6 +434,10 @@ void  A2EventAction::CloseOutput(){
               "       Input file         : %s\n"
               "       Output file        : %s\n"
               "       Tracked particles  : %s\n"
+              "       Acceptance filter  : %s\n"
+              "       Event biasing      : %s\n"
+              "       Stacking           : %s\n"
+              "       Watchdog           : %s\n"
               "       Start time         : %s\n"
               "       Stop time          : %s\n"
               "       Tracking time      : %s\n"
@@ -343,18 +457,56 @@ void  A2EventAction::CloseOutput(){
               inputFile.Data(),
               fOutFile->GetName(),
               trackedPart.Data(),
+              acceptance.Data(),
+              biasing.Data(),
+              stacking.Data(),
+              watchdog.Data(),
               fStartTime.Data(),
               date.AsString(),
               fDuration.Data(),
-              fReqEvents,
+              trackedEvents,
               fEventRate
               ).Data());
   meta.Write();
 
+  // stepping profile
+  if (frunAct->GetProfiler()->IsEnabled())
+    frunAct->GetProfiler()->WriteTree(fOutFile);
+
+  // events aborted by the watchdog
+  if (frunAct->GetWatchdog()->IsEnabled())
+    frunAct->GetWatchdog()->WriteTree(fOutFile);
+
   fOutFile->Close();
   if(fOutFile)delete fOutFile;
 }
 
+void A2EventAction::BeginOfRun()
+{
+  // take the timing and input baselines before the first event is generated
+  fTimer->Start();
+  if (fPGA->GetFileGen()) fInputBytes0 = fPGA->GetFileGen()->GetBytesRead();
+}
+
+void A2EventAction::PrintInputSummary(G4int nEvents)
+{
+  // only useful for dry runs where the input side is all that is timed
+  if (!fPGA->IsDryRun() || nEvents == 0) return;
+
+  Double_t t = fTimer->RealTime();
+  Double_t bytes = 0;
+  if (fPGA->GetFileGen())
+    bytes = fPGA->GetFileGen()->GetBytesRead() - fInputBytes0;
+  TString timeFmt;
+  FormatTimeSec(t, timeFmt);
+
+  G4cout << TString::Format("Dry run: %d events from '%s' generator in %s "
+                            "(%.2f events/s, %.2f MB/s read)",
+                            nEvents, fPGA->GetModeName(), timeFmt.Data(),
+                            t > 0 ? nEvents / t : 0.,
+                            t > 0 ? bytes / t / 1024. / 1024. : 0.) << G4endl;
+}
+
 void A2EventAction::FormatTimeSec(double seconds, TString& out)
 {
   // convert seconds
@@ -368,6 +520,66 @@ void A2EventAction::FormatTimeSec(double seconds, TString& out)
   out.Form("%02d:%02d:%02d", hours, min, sec);
 }
 
+void A2EventAction::WriteCheckpoint(const G4Event* evt)
+{
+  // the checkpoint is stored in the output file and committed together with
+  // the tree by the AutoSave, so both are always consistent
+  if (!fCBOut) return;
+  std::ostringstream oss;
+  oss << "entries " << fCBOut->GetTree()->GetEntries() << "\n"
+      << "events " << fEventsDone0 + evt->GetEventID() + 1 << "\n"
+      << "input " << fPGA->GetInputEntry() + 1 << "\n"
+      << "rndm\n";
+  CLHEP::HepRandom::saveFullState(oss);
+
+  fOutFile->cd();
+  TNamed ckpt("A2Checkpoint", oss.str().c_str());
+  ckpt.Write("A2Checkpoint", TObject::kOverwrite);
+  fCBOut->GetTree()->AutoSave("SaveSelf");
+}
+
+G4int A2EventAction::ReadCheckpoint()
+{
+  // read the last checkpoint of the output file, restore the random engine
+  // and return the number of events processed so far
+  fResume = true;
+  if (fOutFileName == "" || gSystem->AccessPathName(fOutFileName))
+  {
+    G4cout << "A2EventAction::ReadCheckpoint() No output to resume, starting from the beginning" << G4endl;
+    return 0;
+  }
+
+  TFile f(fOutFileName, "READ");
+  if (f.Get("A2Geant4 Metadata"))
+  {
+    G4cout << "A2EventAction::ReadCheckpoint() Output " << fOutFileName << " is already complete" << G4endl;
+    fResumeComplete = true;
+    return 0;
+  }
+  TNamed* ckpt = (TNamed*)f.Get("A2Checkpoint");
+  if (!ckpt)
+  {
+    G4cout << "A2EventAction::ReadCheckpoint() No checkpoint in " << fOutFileName
+           << ", starting from the beginning" << G4endl;
+    return 0;
+  }
+
+  std::istringstream iss(ckpt->GetTitle());
+  std::string key, rndm;
+  iss >> key >> fResumeEntries >> key >> fEventsDone0 >> key >> fResumeInput >> key;
+  if (iss.fail() || key != "rndm")
+  {
+    G4cerr << "A2EventAction::ReadCheckpoint() Invalid checkpoint in " << fOutFileName << G4endl;
+    exit(1);
+  }
+  CLHEP::HepRandom::restoreFullState(iss);
+
+  G4cout << "A2EventAction::ReadCheckpoint() Resuming " << fOutFileName << " after "
+         << fEventsDone0 << " events (" << fResumeEntries << " entries, input entry "
+         << fResumeInput << ")" << G4endl;
+  return fEventsDone0;
+}
+
 void A2EventAction::ReadDetectorSetup(const char* detSetup)
 {
   fDetSetup = detSetup;
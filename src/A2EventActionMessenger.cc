@@ -52,6 +52,18 @@ A2EventActionMessenger::A2EventActionMessenger(A2EventAction* EvAct)
   fStorePrimCmd->SetParameterName("storePrim", true);
   fStorePrimCmd->SetDefaultValue(true);
   fStorePrimCmd->AvailableForStates(G4State_Idle);
+
+  fStoreStatsCmd = new G4UIcmdWithABool("/A2/event/storeEventStats", this);
+  fStoreStatsCmd->SetGuidance("Store per-event CPU time, steps, secondaries and maximum stack depth");
+  fStoreStatsCmd->SetParameterName("storeStats", true);
+  fStoreStatsCmd->SetDefaultValue(true);
+  fStoreStatsCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fCheckpointCmd = new G4UIcmdWithAnInteger("/A2/event/checkpoint", this);
+  fCheckpointCmd->SetGuidance("Flush the output and save a checkpoint for --resume every n events (0 to disable)");
+  fCheckpointCmd->SetParameterName("n", false);
+  fCheckpointCmd->SetRange("n>=0");
+  fCheckpointCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 }
 
 
@@ -63,6 +75,8 @@ A2EventActionMessenger::~A2EventActionMessenger()
   delete fPrintCmd;
   delete feventDir;
   delete fStorePrimCmd;
+  delete fStoreStatsCmd;
+  delete fCheckpointCmd;
 }
 
 
@@ -85,6 +99,12 @@ void A2EventActionMessenger::SetNewValue(
 
   if (command == fStorePrimCmd)
     feventAction->SetStorePrimaries(fStorePrimCmd->GetNewBoolValue(newValue));
+
+  if (command == fStoreStatsCmd)
+    feventAction->SetStoreEventStats(fStoreStatsCmd->GetNewBoolValue(newValue));
+
+  if (command == fCheckpointCmd)
+    feventAction->SetCheckpoint(fCheckpointCmd->GetNewIntValue(newValue));
 }
 
 
@@ -4,6 +4,8 @@
 #include "TMath.h"
 
 #include "G4ParticleDefinition.hh"
+#include "G4ParticleTable.hh"
+#include "G4IonTable.hh"
 #include "Randomize.hh"
 
 #include "A2FileGenerator.hh"
@@ -18,6 +20,9 @@ A2FileGenerator::A2FileGenerator(const char* filename, EFileGenType type)
     fFileName = filename;
     fNEvents = 0;
     fWeight = 1;
+    fGenVertex = false;
+    fVerbose = true;
+    fAsync = false;
 }
 
 //______________________________________________________________________________
@@ -91,6 +96,140 @@ void A2FileGenerator::GenerateVertexCylinder(G4double t_length, G4double t_cente
     }
     Double_t vZ = t_length / 2. * (2. * G4UniformRand() - 1.) + t_center;
     fVertex.set(vX, vY, vZ);
+    fGenVertex = true;
+}
+
+//______________________________________________________________________________
+G4ParticleDefinition* A2FileGenerator::FindParticle(G4int pdg)
+{
+    // Return the particle definition of the particle (or ion) with PDG code
+    // 'pdg'. When decoding outside the main thread, only definitions already
+    // in the cache are returned as the particle table must not be modified.
+
+    // look in the cache
+    std::map<G4int, G4ParticleDefinition*>::const_iterator it = fPartCache.find(pdg);
+    if (it != fPartCache.end())
+        return it->second;
+    if (fAsync)
+        return 0;
+
+    // look-up particle
+    G4ParticleDefinition* partDef = G4ParticleTable::GetParticleTable()->FindParticle(pdg);
+    if (!partDef)
+    {
+        G4int Z, A, L, J;
+        G4double E;
+        if (G4IonTable::GetNucleusByEncoding(pdg, Z, A, L, E, J))
+            partDef = G4ParticleTable::GetParticleTable()->GetIonTable()->GetIon(Z, A, L, 0.0, J);
+    }
+    fPartCache[pdg] = partDef;
+
+    return partDef;
+}
+
+//______________________________________________________________________________
+void A2FileGenerator::FillParticleCache()
+{
+    // Add all particles currently defined to the particle cache. Must be
+    // called in the main thread.
+
+    G4ParticleTable::G4PTblDicIterator* it = G4ParticleTable::GetParticleTable()->GetIterator();
+    it->reset();
+    while ((*it)())
+    {
+        G4ParticleDefinition* partDef = it->value();
+        if (partDef->GetPDGEncoding() && !fPartCache.count(partDef->GetPDGEncoding()))
+            fPartCache[partDef->GetPDGEncoding()] = partDef;
+    }
+}
+
+//______________________________________________________________________________
+void A2FileGenerator::ResolveParticles()
+{
+    // Resolve the definitions of particles that could not be looked-up during
+    // decoding outside the main thread. Particles rejected by
+    // CompleteParticle() are removed from the event.
+
+    for (G4int i = 0; i < (G4int)fPart.size(); i++)
+    {
+        // skip resolved particles
+        if (!fPart[i].fPDG)
+            continue;
+
+        fPart[i].fDef = FindParticle(fPart[i].fPDG);
+        fPart[i].fPDG = 0;
+        if (!CompleteParticle(fPart[i]))
+        {
+            fPart.erase(fPart.begin() + i);
+            i--;
+        }
+    }
+}
+
+//______________________________________________________________________________
+G4bool A2FileGenerator::CompleteParticle(A2GenParticle_t& part)
+{
+    // Finish the particle 'part' after its definition was looked-up.
+    // Return false if the particle should not be added to the event.
+
+    if (!part.fDef)
+        return false;
+
+    part.SetCorrectMass(true);
+
+    return true;
+}
+
+//______________________________________________________________________________
+void A2FileGenerator::SaveEvent(A2GenEvent_t& ev) const
+{
+    // Copy the current event data to 'ev'.
+
+    ev.fWeight = fWeight;
+    ev.fBeam = fBeam;
+    ev.fVertex = fVertex;
+    ev.fPart = fPart;
+}
+
+//______________________________________________________________________________
+void A2FileGenerator::LoadEvent(A2GenEvent_t& ev)
+{
+    // Make the event data in 'ev' the current event. The particle list is
+    // swapped, i.e. 'ev' is left with the previous list.
+
+    fWeight = ev.fWeight;
+    fBeam = ev.fBeam;
+    fVertex = ev.fVertex;
+    fPart.swap(ev.fPart);
+}
+
+//______________________________________________________________________________
+void A2FileGenerator::ShiftVertex(const G4ThreeVector& v)
+{
+    // Shift the primary vertex and all particle vertices by 'v'.
+
+    fVertex += v;
+    for (G4int i = 0; i < (G4int)fPart.size(); i++)
+        fPart[i].fX += v;
+}
+
+//______________________________________________________________________________
+const char* A2FileGenerator::GetTypeName() const
+{
+    // Return the name of the generator type.
+
+    switch (fType)
+    {
+        case kMkin: return "Mkin";
+        case kPluto: return "Pluto";
+        case kPlutoCocktail: return "Pluto Cocktail";
+        case kGiBUU: return "GiBUU";
+        case kHepMC: return "HepMC";
+        case kLHEF: return "LHEF";
+        case kBinary: return "Binary stream";
+        case kReaction: return "Reaction";
+        default: return "Unknown";
+    }
 }
 
 //______________________________________________________________________________
@@ -98,19 +237,7 @@ void A2FileGenerator::Print() const
 {
     // Print the content of this class.
 
-    G4String type;
-    if (fType == kMkin)
-        type = "Mkin";
-    else if (fType == kPluto)
-        type = "Pluto";
-    else if (fType == kPlutoCocktail)
-        type = "Pluto Cocktail";
-    else if (fType == kGiBUU)
-        type = "GiBUU";
-    else
-        type = "Unknown";
-
-    G4cout << "Generator type      : " << type << G4endl
+    G4cout << "Generator type      : " << GetTypeName() << G4endl
            << "File name           : " << fFileName << G4endl
            << "Number of events    : " << fNEvents << G4endl
            << "Event weight        : " << fWeight << G4endl
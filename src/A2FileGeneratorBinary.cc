@@ -0,0 +1,225 @@
+// event generator reading a compact binary event stream, e.g. from a named
+// pipe or stdin written by an event generator running concurrently
+// Author: Dominik Werthmueller, 2026
+
+#include <istream>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include "CLHEP/Units/SystemOfUnits.h"
+
+#include "A2FileGeneratorBinary.hh"
+
+using namespace CLHEP;
+
+const G4int A2FileGeneratorBinary::fgMaxStreamParticles = 10000;
+
+//______________________________________________________________________________
+A2FileGeneratorBinary::A2FileGeneratorBinary(const char* filename)
+    : A2FileGeneratorStream(filename, kBinary)
+{
+    // Constructor.
+
+    // init members
+    fBufferSize = 1000;
+    fReader = 0;
+    fReaderThread = 0;
+    fMaxPart = fgMaxStreamParticles;
+}
+
+//______________________________________________________________________________
+A2FileGeneratorBinary::~A2FileGeneratorBinary()
+{
+    // Destructor.
+
+    if (fReaderThread)
+    {
+        fReader->fQueue.Close();
+        if (fReader->fDone)
+        {
+            fReaderThread->join();
+            delete fReader;
+        }
+        else
+        {
+            // the reader may be blocked in read() on an idle pipe: leave it
+            // behind together with its state and the input stream
+            fReaderThread->detach();
+            fFile = 0;
+        }
+        delete fReaderThread;
+    }
+    else if (fReader)
+    {
+        delete fReader;
+    }
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorBinary::Init()
+{
+    // Init the stream event reader.
+
+    // call parent method
+    if (!A2FileGeneratorStream::Init())
+        return false;
+
+    // create the reader state
+    fReader = new A2BinReader_t(fStream, fBufferSize);
+
+    // check header
+    char magic[4];
+    uint32_t version;
+    if (!ReadData(fReader, magic, 4) || memcmp(magic, "A2EV", 4) != 0 ||
+        !ReadData(fReader, &version, sizeof(version)))
+    {
+        G4cout << "A2FileGeneratorBinary::Init(): " << fFileName
+               << " is not an A2 binary event stream!" << G4endl;
+        return false;
+    }
+    if (version != 1)
+    {
+        G4cout << "A2FileGeneratorBinary::Init(): Unsupported stream version "
+               << version << "!" << G4endl;
+        return false;
+    }
+
+    // start the reader thread
+    fReaderThread = new std::thread(ReaderLoop, fReader);
+
+    // user info
+    G4cout << "A2FileGeneratorBinary::Init(): Buffering up to " << fBufferSize
+           << " events" << G4endl;
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorBinary::ReadData(A2BinReader_t* r, void* data, size_t size)
+{
+    // Read 'size' bytes from the stream of 'r' into 'data'.
+
+    r->fIn->read((char*)data, size);
+    r->fBytes += r->fIn->gcount();
+    if ((size_t)r->fIn->gcount() != size)
+        return false;
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorBinary::ReadRecord(A2BinReader_t* r, A2BinEvent_t& ev)
+{
+    // Read the next event record from the stream of 'r' into 'ev'. Return
+    // false at the end of the stream or if the record is corrupt, in which
+    // case the error is set in 'r'.
+
+    // number of particles (the stream may only end here)
+    G4long start = r->fBytes;
+    uint32_t nPart;
+    if (!ReadData(r, &nPart, sizeof(nPart)))
+    {
+        if (r->fBytes != start)
+            r->fError = "truncated event record";
+        return false;
+    }
+    if (nPart > (uint32_t)fgMaxStreamParticles)
+    {
+        r->fError = "event record with " + std::to_string(nPart) + " particles (maximum is " +
+                    std::to_string(fgMaxStreamParticles) + ")";
+        return false;
+    }
+
+    // event data
+    int32_t beamPDG;
+    if (!ReadData(r, &ev.fWeight, sizeof(G4double)) ||
+        !ReadData(r, &beamPDG, sizeof(beamPDG)) ||
+        !ReadData(r, ev.fBeam, 4*sizeof(G4double)) ||
+        !ReadData(r, ev.fVertex, 4*sizeof(G4double)))
+    {
+        r->fError = "truncated event record";
+        return false;
+    }
+    ev.fBeamPDG = beamPDG;
+
+    // particles
+    ev.fPDG.resize(nPart);
+    ev.fMom.resize(4*nPart);
+    for (uint32_t i = 0; i < nPart; i++)
+    {
+        int32_t pdg;
+        if (!ReadData(r, &pdg, sizeof(pdg)) ||
+            !ReadData(r, &ev.fMom[4*i], 4*sizeof(G4double)))
+        {
+            r->fError = "truncated event record";
+            return false;
+        }
+        ev.fPDG[i] = pdg;
+    }
+
+    return true;
+}
+
+//______________________________________________________________________________
+void A2FileGeneratorBinary::ReaderLoop(A2BinReader_t* r)
+{
+    // Read event records from the stream into the event buffer until the end
+    // of the stream is reached or the buffer is closed. Runs in the reader
+    // thread.
+
+    for (;;)
+    {
+        A2BinEvent_t ev;
+        if (!ReadRecord(r, ev))
+            break;
+        if (!r->fQueue.Push(ev))
+        {
+            r->fDone = true;
+            return;
+        }
+    }
+
+    // signal end of stream
+    r->fQueue.Close();
+    r->fDone = true;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorBinary::ParseEvent()
+{
+    // Take the next event from the buffer and convert it. Return false at the
+    // end of the stream, exit on corrupt records.
+
+    A2BinEvent_t ev;
+    if (!fReader->fQueue.Pop(ev))
+    {
+        // the error is set before the queue is closed
+        if (!fReader->fError.empty())
+        {
+            G4cout << "A2FileGeneratorBinary::ParseEvent(): Corrupt stream " << fFileName
+                   << ": " << fReader->fError << " before byte " << fReader->fBytes << "!" << G4endl;
+            exit(1);
+        }
+        return false;
+    }
+
+    // event weight and vertex
+    SetWeight(ev.fWeight);
+    fVertex.set(ev.fVertex[0]*mm, ev.fVertex[1]*mm, ev.fVertex[2]*mm);
+
+    // beam
+    SetBeam(ev.fBeamPDG, G4ThreeVector(ev.fBeam[0]*MeV, ev.fBeam[1]*MeV, ev.fBeam[2]*MeV),
+            ev.fBeam[3]*MeV);
+
+    // particles
+    for (G4int i = 0; i < (G4int)ev.fPDG.size(); i++)
+    {
+        const G4double* p = &ev.fMom[4*i];
+        AddParticle(ev.fPDG[i], G4ThreeVector(p[0]*MeV, p[1]*MeV, p[2]*MeV), p[3]*MeV,
+                    G4ThreeVector(0, 0, 0), ev.fVertex[3]*ns);
+    }
+
+    return true;
+}
@@ -1,8 +1,7 @@
 // event generator reading GiBUU ROOT files
 // Author: Dominik Werthmueller, 2019
 
-#include "G4ParticleTable.hh"
-#include "G4IonTable.hh"
+#include "G4ParticleDefinition.hh"
 
 #include "TMath.h"
 #include "TTree.h"
@@ -65,12 +64,12 @@ G4bool A2FileGeneratorGiBUU::Init()
 }
 
 //______________________________________________________________________________
-G4bool A2FileGeneratorGiBUU::ReadEvent(G4int event)
+G4bool A2FileGeneratorGiBUU::ReadEntry(G4int entry)
 {
-    // Read the event 'event'.
+    // Read the tree entry 'entry'.
 
     // call parent method
-    if (!A2FileGeneratorTree::ReadEvent(event))
+    if (!A2FileGeneratorTree::ReadEntry(entry))
         return false;
 
     // clear particles
@@ -82,64 +81,88 @@ G4bool A2FileGeneratorGiBUU::ReadEvent(G4int event)
     // loop over particles
     for (UInt_t i = 0; i < fReaderCode->size(); i++)
     {
+        // set event particle
+        A2GenParticle_t part;
+        part.fP.set(fReaderPx->at(i)*GeV, fReaderPy->at(i)*GeV, fReaderPz->at(i)*GeV);
+        part.fE = fReaderE->at(i)*GeV;
+        part.fX = fVertex;
+        part.fT = 0;
+        part.fIsTrack = true;
+
         // look-up particle
         Int_t pdg = fReaderCode->at(i);
-        G4ParticleDefinition* partDef = G4ParticleTable::GetParticleTable()->FindParticle(pdg);
-        if (!partDef)
+        part.fDef = FindParticle(pdg);
+        if (!part.fDef && fAsync)
         {
-            G4int Z, A, L, J;
-            G4double E;
-            if (G4IonTable::GetNucleusByEncoding(pdg, Z, A, L, E, J))
-                partDef = G4ParticleTable::GetParticleTable()->GetIonTable()->GetIon(Z, A, L, 0.0, J);
+            // resolve later in the main thread
+            part.fPDG = pdg;
+            if (fPart.size() < fgMaxParticles)
+                fPart.push_back(part);
+            continue;
         }
-        if (!partDef)
+        if (!part.fDef)
         {
             // user info
-            G4cout << "A2FileGeneratorGiBUU::Init(): Undefined particle with PDG ID " << pdg
-                   << " will not be tracked!" << G4endl;
+            if (fVerbose)
+                G4cout << "A2FileGeneratorGiBUU::Init(): Undefined particle with PDG ID " << pdg
+                       << " will not be tracked!" << G4endl;
             continue;
         }
 
-        // check for off-shell particles
-        Double_t e = 1000 * fReaderE->at(i);
-        switch (partDef->GetPDGEncoding())
-        {
-            case  111: // pi0
-            case  211: // pi+
-            case -211: // pi+
-                if (e < 138.0)
-                    continue;
-                else
-                    break;
-            case 2212: // proton
-            case 2112: // neutron
-                if (e < 938.0)
-                    continue;
-                else
-                    break;
-            default:
-                G4cout << "A2FileGeneratorGiBUU::Init(): No off-shell cuts defined for particle " <<
-                       partDef->GetParticleName() << G4endl;
-        }
-
-        // set event particle
-        A2GenParticle_t part;
-        part.fDef = partDef;
-        part.fP.set(fReaderPx->at(i)*GeV, fReaderPy->at(i)*GeV, fReaderPz->at(i)*GeV);
-        part.fE = fReaderE->at(i)*GeV;
-        part.SetCorrectMass(true);
-        part.fX = fVertex;
-        part.fT = 0;
-        part.fIsTrack = true;
-
         // add event particle
-        if (!std::isnan(part.fP.mag()) && fPart.size() < fgMaxParticles)
+        if (CompleteParticle(part) && fPart.size() < fgMaxParticles)
             fPart.push_back(part);
     }
 
     return true;
 }
 
+//______________________________________________________________________________
+G4bool A2FileGeneratorGiBUU::CompleteParticle(A2GenParticle_t& part)
+{
+    // Finish the particle 'part' after its definition was looked-up.
+    // Return false for undefined, off-shell or invalid particles.
+
+    if (!part.fDef)
+        return false;
+
+    // check for off-shell particles
+    Double_t e = part.fE / MeV;
+    switch (part.fDef->GetPDGEncoding())
+    {
+        case  111: // pi0
+        case  211: // pi+
+        case -211: // pi+
+            if (e < 138.0)
+                return false;
+            else
+                break;
+        case 2212: // proton
+        case 2112: // neutron
+            if (e < 938.0)
+                return false;
+            else
+                break;
+        default:
+            if (fVerbose)
+                G4cout << "A2FileGeneratorGiBUU::Init(): No off-shell cuts defined for particle " <<
+                       part.fDef->GetParticleName() << G4endl;
+    }
+
+    // set mass
+    part.SetCorrectMass(true);
+
+    return !std::isnan(part.fP.mag());
+}
+
+//______________________________________________________________________________
+A2FileGeneratorTree* A2FileGeneratorGiBUU::CreateReader() const
+{
+    // Return a new reader instance of the same input file.
+
+    return new A2FileGeneratorGiBUU(fFileName.c_str());
+}
+
 //______________________________________________________________________________
 G4int A2FileGeneratorGiBUU::GetMaxParticles()
 {
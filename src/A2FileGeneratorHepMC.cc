@@ -0,0 +1,246 @@
+// event generator reading HepMC3 ASCII event-files
+// Author: Dominik Werthmueller, 2026
+
+#include <sstream>
+#include <map>
+
+#include "CLHEP/Units/SystemOfUnits.h"
+#include "CLHEP/Units/PhysicalConstants.h"
+
+#include "A2FileGeneratorHepMC.hh"
+
+using namespace CLHEP;
+
+//______________________________________________________________________________
+A2FileGeneratorHepMC::A2FileGeneratorHepMC(const char* filename)
+    : A2FileGeneratorStream(filename, kHepMC)
+{
+    // Constructor.
+
+    // init members (HepMC3 default units)
+    fMomUnit = GeV;
+    fLengthUnit = mm;
+}
+
+//______________________________________________________________________________
+A2FileGeneratorHepMC::~A2FileGeneratorHepMC()
+{
+    // Destructor.
+
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorHepMC::Init()
+{
+    // Init the file event reader.
+
+    // call parent method
+    if (!A2FileGeneratorStream::Init())
+        return false;
+
+    // read header
+    while (ReadLine())
+    {
+        if (fLine.compare(0, 34, "HepMC::Asciiv3-START_EVENT_LISTING") == 0)
+            return true;
+        else if (fLine.compare(0, 19, "HepMC::IO_GenEvent-") == 0)
+        {
+            G4cout << "A2FileGeneratorHepMC::Init(): HepMC2 event-files are not supported, "
+                   << "please use the HepMC3 ASCII format!" << G4endl;
+            return false;
+        }
+        else if (fLine[0] == 'E')
+        {
+            // no header
+            PushBack();
+            return true;
+        }
+    }
+
+    G4cout << "A2FileGeneratorHepMC::Init(): No HepMC3 event listing found in "
+           << fFileName << "!" << G4endl;
+
+    return false;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorHepMC::ParseEvent()
+{
+    // Parse the next event. Final-state particles (status 1) are added to the
+    // event, the beam is taken from the incoming particles (status 4).
+
+    // particle of the HepMC event record
+    struct HepMCPart_t {
+        G4int fID;
+        G4int fProd;
+        G4int fPDG;
+        G4int fStatus;
+        G4ThreeVector fP;
+        G4double fE;
+    };
+
+    // look for the next event
+    while (ReadLine())
+    {
+        if (fLine[0] == 'E')
+            break;
+    }
+    if (fLine.empty())
+        return false;
+
+    // event line: E event-number n-vertices n-particles [@ x y z t]
+    G4int evtNb, nVtx, nPart;
+    std::istringstream ssEvt(fLine.substr(1));
+    if (!(ssEvt >> evtNb >> nVtx >> nPart))
+        ParseError("Malformed event line");
+
+    // event position (optional)
+    G4ThreeVector evtPos(0, 0, 0);
+    G4double evtTime = 0;
+    size_t at = fLine.find('@');
+    if (at != std::string::npos)
+    {
+        G4double x, y, z, t;
+        std::istringstream ss(fLine.substr(at+1));
+        if (!(ss >> x >> y >> z >> t))
+            ParseError("Malformed event position");
+        evtPos.set(x, y, z);
+        evtTime = t;
+    }
+
+    // read event record
+    std::vector<HepMCPart_t> parts;
+    std::map<G4int, G4ThreeVector> vtxPos;
+    std::map<G4int, G4double> vtxTime;
+    std::map<G4int, G4int> endVtx;
+    while (ReadLine())
+    {
+        // check for end of event
+        if (fLine[0] == 'E' || fLine.compare(0, 7, "HepMC::") == 0)
+        {
+            PushBack();
+            break;
+        }
+
+        std::istringstream ss(fLine.substr(1));
+        switch (fLine[0])
+        {
+            case 'U':
+            {
+                // units
+                std::string mom, len;
+                if (!(ss >> mom >> len))
+                    ParseError("Malformed units line");
+                fMomUnit = mom == "MEV" ? MeV : GeV;
+                fLengthUnit = len == "CM" ? cm : mm;
+                break;
+            }
+            case 'W':
+            {
+                // first weight is the event weight
+                G4double w;
+                if (!(ss >> w))
+                    ParseError("Malformed weight line");
+                SetWeight(w);
+                break;
+            }
+            case 'P':
+            {
+                // particle
+                HepMCPart_t p;
+                G4double px, py, pz, m;
+                if (!(ss >> p.fID >> p.fProd >> p.fPDG >> px >> py >> pz >> p.fE >> m >> p.fStatus))
+                    ParseError("Malformed particle line");
+                p.fP.set(px, py, pz);
+                parts.push_back(p);
+                break;
+            }
+            case 'V':
+            {
+                // vertex
+                G4int id, status;
+                if (!(ss >> id >> status))
+                    ParseError("Malformed vertex line");
+
+                // incoming particles
+                size_t beg = fLine.find('[');
+                size_t end = fLine.find(']');
+                if (beg != std::string::npos && end != std::string::npos)
+                {
+                    std::string in = fLine.substr(beg+1, end-beg-1);
+                    for (size_t i = 0; i < in.size(); i++)
+                        if (in[i] == ',') in[i] = ' ';
+                    std::istringstream ssIn(in);
+                    G4int pid;
+                    while (ssIn >> pid)
+                        endVtx[pid] = id;
+                }
+
+                // position (optional)
+                size_t vat = fLine.find('@');
+                if (vat != std::string::npos)
+                {
+                    G4double x, y, z, t;
+                    std::istringstream ssPos(fLine.substr(vat+1));
+                    if (!(ssPos >> x >> y >> z >> t))
+                        ParseError("Malformed vertex position");
+                    vtxPos[id].set(x, y, z);
+                    vtxTime[id] = t;
+                }
+                break;
+            }
+            default:
+                // attributes, run info etc. are not used
+                break;
+        }
+    }
+
+    // the event ends early at the end of the input
+    if ((G4int)parts.size() != nPart)
+    {
+        fLine.clear();
+        ParseError("Truncated event");
+    }
+
+    // convert particles
+    G4int beam = -1;
+    for (G4int i = 0; i < (G4int)parts.size(); i++)
+    {
+        const HepMCPart_t& p = parts[i];
+
+        // beam: first incoming photon, otherwise first incoming particle
+        if (p.fStatus == 4)
+        {
+            if (beam < 0 || (p.fPDG == 22 && parts[beam].fPDG != 22))
+                beam = i;
+            continue;
+        }
+
+        // skip non-final-state particles
+        if (p.fStatus != 1)
+            continue;
+
+        // production vertex: vertex ID or ID of the mother particle
+        G4int vtx = p.fProd;
+        if (vtx > 0)
+            vtx = endVtx.count(vtx) ? endVtx[vtx] : 0;
+        G4ThreeVector x = evtPos;
+        G4double t = evtTime;
+        if (vtxPos.count(vtx))
+        {
+            x += vtxPos[vtx];
+            t += vtxTime[vtx];
+        }
+
+        // add particle (HepMC time in length units, c=1)
+        AddParticle(p.fPDG, p.fP*fMomUnit, p.fE*fMomUnit,
+                    x*fLengthUnit, t*fLengthUnit/c_light);
+    }
+
+    // set beam
+    if (beam >= 0)
+        SetBeam(parts[beam].fPDG, parts[beam].fP*fMomUnit, parts[beam].fE*fMomUnit);
+
+    return true;
+}
+
@@ -0,0 +1,118 @@
+// event generator reading Les Houches event-files (LHEF)
+// Author: Dominik Werthmueller, 2026
+
+#include <sstream>
+
+#include "CLHEP/Units/SystemOfUnits.h"
+
+#include "A2FileGeneratorLHEF.hh"
+
+using namespace CLHEP;
+
+//______________________________________________________________________________
+A2FileGeneratorLHEF::A2FileGeneratorLHEF(const char* filename)
+    : A2FileGeneratorStream(filename, kLHEF)
+{
+    // Constructor.
+
+}
+
+//______________________________________________________________________________
+A2FileGeneratorLHEF::~A2FileGeneratorLHEF()
+{
+    // Destructor.
+
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorLHEF::Init()
+{
+    // Init the file event reader.
+
+    // call parent method
+    if (!A2FileGeneratorStream::Init())
+        return false;
+
+    // skip header and init block
+    while (ReadLine())
+    {
+        if (fLine.compare(0, 6, "<event") == 0)
+        {
+            PushBack();
+            return true;
+        }
+    }
+
+    G4cout << "A2FileGeneratorLHEF::Init(): No events found in " << fFileName << "!" << G4endl;
+
+    return false;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorLHEF::ParseEvent()
+{
+    // Parse the next event. Outgoing particles (ISTUP 1) are added to the
+    // event, the beam is taken from the incoming particles (ISTUP -1).
+
+    // look for the next event
+    while (ReadLine())
+    {
+        if (fLine.compare(0, 6, "<event") == 0)
+            break;
+        if (fLine.compare(0, 19, "</LesHouchesEvents>") == 0)
+            return false;
+    }
+    if (fLine.empty())
+        return false;
+
+    // event header: NUP IDPRUP XWGTUP SCALUP AQEDUP AQCDUP
+    if (!ReadLine())
+        ParseError("Truncated event");
+    G4int nPart, procID;
+    G4double weight;
+    std::istringstream ssHead(fLine);
+    if (!(ssHead >> nPart >> procID >> weight))
+        ParseError("Malformed event header");
+    SetWeight(weight);
+
+    // particles: IDUP ISTUP MOTHUP(2) ICOLUP(2) PUP(5) VTIMUP SPINUP
+    G4int beamPDG = 0;
+    for (G4int i = 0; i < nPart; i++)
+    {
+        if (!ReadLine())
+            ParseError("Truncated event");
+
+        G4int pdg, status, m1, m2, c1, c2;
+        G4double px, py, pz, e, m;
+        std::istringstream ss(fLine);
+        if (!(ss >> pdg >> status >> m1 >> m2 >> c1 >> c2 >> px >> py >> pz >> e >> m))
+            ParseError("Malformed particle line");
+        G4ThreeVector p(px*GeV, py*GeV, pz*GeV);
+
+        // beam: first incoming photon, otherwise first incoming particle
+        if (status == -1)
+        {
+            if (beamPDG == 0 || (pdg == 22 && beamPDG != 22))
+            {
+                SetBeam(pdg, p, e*GeV);
+                beamPDG = pdg;
+            }
+        }
+        // outgoing particles
+        else if (status == 1)
+        {
+            AddParticle(pdg, p, e*GeV, G4ThreeVector(0, 0, 0), 0);
+        }
+    }
+
+    // skip optional event information
+    while (ReadLine())
+    {
+        if (fLine.compare(0, 8, "</event>") == 0)
+            return true;
+    }
+
+    ParseError("Truncated event");
+    return false;
+}
+
@@ -120,8 +120,9 @@ G4bool A2FileGeneratorMkin::Init()
                     LinkBranch(TString::Format("Vy_l%02d%02d", i+1, g3_id).Data(), &fPartVBr[fNPart][1], false);
                     LinkBranch(TString::Format("Vz_l%02d%02d", i+1, g3_id).Data(), &fPartVBr[fNPart][2], false);
                     LinkBranch(TString::Format("Vt_l%02d%02d", i+1, g3_id).Data(), &fPartVBr[fNPart][3], false);
-                    G4cout << "A2FileGeneratorMkin::Init(): Found vertex branches for particle " << g3_id <<
-                           " with index " << fNPart+1 << G4endl;
+                    if (fVerbose)
+                        G4cout << "A2FileGeneratorMkin::Init(): Found vertex branches for particle " << g3_id <<
+                               " with index " << fNPart+1 << G4endl;
                 }
 
                 // look-up particle
@@ -142,11 +143,12 @@ G4bool A2FileGeneratorMkin::Init()
                         partDef = G4ParticleTable::GetParticleTable()->FindParticle(310);
 
                     // user info
-                    G4cout << "A2FileGeneratorMkin::Init(): Adding a " << partDef->GetParticleName()
-                           << " (Geant3 ID: " << g3_id << ", PDG ID: " << partDef->GetPDGEncoding() << ")"
-                           << " as index " << fNPart+1 << G4endl;
+                    if (fVerbose)
+                        G4cout << "A2FileGeneratorMkin::Init(): Adding a " << partDef->GetParticleName()
+                               << " (Geant3 ID: " << g3_id << ", PDG ID: " << partDef->GetPDGEncoding() << ")"
+                               << " as index " << fNPart+1 << G4endl;
                 }
-                else
+                else if (fVerbose)
                 {
                     // user info
                     G4cout << "A2FileGeneratorMkin::Init(): Undefined particle (GEANT3 ID: " << g3_id
@@ -170,12 +172,12 @@ G4bool A2FileGeneratorMkin::Init()
 }
 
 //______________________________________________________________________________
-G4bool A2FileGeneratorMkin::ReadEvent(G4int event)
+G4bool A2FileGeneratorMkin::ReadEntry(G4int entry)
 {
-    // Read the event 'event'.
+    // Read the tree entry 'entry'.
 
     // call parent method
-    if (!A2FileGeneratorTree::ReadEvent(event))
+    if (!A2FileGeneratorTree::ReadEntry(entry))
         return false;
 
     // set vertex event data
@@ -221,6 +223,14 @@ G4bool A2FileGeneratorMkin::ReadEvent(G4int event)
     return true;
 }
 
+//______________________________________________________________________________
+A2FileGeneratorTree* A2FileGeneratorMkin::CreateReader() const
+{
+    // Return a new reader instance of the same input file.
+
+    return new A2FileGeneratorMkin(fFileName.c_str());
+}
+
 //______________________________________________________________________________
 G4int A2FileGeneratorMkin::GetMaxParticles()
 {
@@ -3,8 +3,7 @@
 
 #ifdef WITH_PLUTO
 
-#include "G4ParticleTable.hh"
-#include "G4IonTable.hh"
+#include "G4ParticleDefinition.hh"
 
 #include "TTreeReader.h"
 
@@ -98,12 +97,12 @@ G4bool A2FileGeneratorPluto::Init()
 }
 
 //______________________________________________________________________________
-G4bool A2FileGeneratorPluto::ReadEvent(G4int event)
+G4bool A2FileGeneratorPluto::ReadEntry(G4int entry)
 {
-    // Read the event 'event'.
+    // Read the tree entry 'entry'.
 
-    // read event
-    if (!fReader->Next())
+    // read event (random access for resumed runs)
+    if (fReader->SetEntry(entry) != TTreeReader::kEntryValid)
         return false;
 
     // clear particles
@@ -121,6 +120,10 @@ G4bool A2FileGeneratorPluto::ReadEvent(G4int event)
         part.fP.set(ppart.Px()*GeV, ppart.Py()*GeV, ppart.Pz()*GeV);
         part.fE = ppart.E()*GeV;
         part.SetCorrectMass();
+
+        // resolve later in the main thread
+        if (!part.fDef && fAsync && ppart.ID() >= 0 && ppart.ID() < 70)
+            part.fPDG = fgPlutoG4Conversion[ppart.ID()];
         part.fX.set(fVertex.x() + ppart.X()*mm,
                     fVertex.y() + ppart.Y()*mm,
                     fVertex.z() + ppart.Z()*mm);
@@ -145,14 +148,14 @@ G4bool A2FileGeneratorPluto::ReadEvent(G4int event)
             {
                 target_mass = target_def->GetPDGMass() / 1000;
             }
-            else
+            else if (fVerbose)
             {
-                G4cout << "A2FileGeneratorPluto::ReadEvent(): Unknown ID of target particle ("
+                G4cout << "A2FileGeneratorPluto::ReadEntry(): Unknown ID of target particle ("
                        << target_id << ")" << G4endl;
             }
 
             // set beam (assume photon beam);
-            fBeam.fDef = G4ParticleTable::GetParticleTable()->FindParticle(22);
+            fBeam.fDef = FindParticle(22);
             fBeam.fP.set(ppart.Px()*GeV, ppart.Py()*GeV, ppart.Pz()*GeV);
             fBeam.fE = (ppart.E() - target_mass)*GeV;
             fBeam.fM = 0;
@@ -163,6 +166,20 @@ G4bool A2FileGeneratorPluto::ReadEvent(G4int event)
         fPart.push_back(part);
     }
 
+    // the tree reader reads the branches on access only
+    StopCacheLearning();
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorPluto::CompleteParticle(A2GenParticle_t& part)
+{
+    // Finish the particle 'part' after its definition was looked-up.
+    // Particles without definition are kept like in ReadEntry().
+
+    part.SetCorrectMass();
+
     return true;
 }
 
@@ -174,20 +191,20 @@ G4ParticleDefinition* A2FileGeneratorPluto::PlutoToG4(Int_t id)
     // check for valid Pluto particle ID range
     if (id >= 0 && id < 70)
     {
-        G4ParticleDefinition* partDef = G4ParticleTable::GetParticleTable()->FindParticle(fgPlutoG4Conversion[id]);
-        if (!partDef)
-        {
-            G4int Z, A, L, J;
-            G4double E;
-            if (G4IonTable::GetNucleusByEncoding(fgPlutoG4Conversion[id], Z, A, L, E, J))
-                partDef = G4ParticleTable::GetParticleTable()->GetIonTable()->GetIon(Z, A, L, 0.0, J);
-        }
-        return partDef;
+        return fgPlutoG4Conversion[id] ? FindParticle(fgPlutoG4Conversion[id]) : 0;
     }
     else
         return 0;
 }
 
+//______________________________________________________________________________
+A2FileGeneratorTree* A2FileGeneratorPluto::CreateReader() const
+{
+    // Return a new reader instance of the same input file.
+
+    return new A2FileGeneratorPluto(fFileName.c_str());
+}
+
 //______________________________________________________________________________
 G4int A2FileGeneratorPluto::GetMaxParticles()
 {
@@ -0,0 +1,180 @@
+// abstract event generator reading text event-files sequentially
+// (regular files, named pipes or stdin)
+// Author: Dominik Werthmueller, 2026
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+
+#include "G4ParticleDefinition.hh"
+
+#include "A2FileGeneratorStream.hh"
+
+const G4int A2FileGeneratorStream::fgMaxParticles = 99;
+
+//______________________________________________________________________________
+A2FileGeneratorStream::A2FileGeneratorStream(const char* filename, EFileGenType type)
+    : A2FileGenerator(filename, type)
+{
+    // Constructor. The file name '-' selects the standard input.
+
+    // init members
+    fStream = 0;
+    fFile = 0;
+    fBytesRead = 0;
+    fPushedBack = false;
+    fMaxPart = fgMaxParticles;
+    fWarnMaxPart = false;
+
+    // the number of events is not known in advance
+    fNEvents = -1;
+
+    // open input
+    if (fFileName == "-")
+    {
+        fStream = &std::cin;
+    }
+    else
+    {
+        fFile = new std::ifstream(fFileName.c_str(), std::ios::in | std::ios::binary);
+        if (!fFile->is_open())
+        {
+            G4cout << "A2FileGeneratorStream::A2FileGeneratorStream(): Could not open the input file "
+                   << fFileName << "!" << G4endl;
+            return;
+        }
+        fStream = fFile;
+    }
+}
+
+//______________________________________________________________________________
+A2FileGeneratorStream::~A2FileGeneratorStream()
+{
+    // Destructor.
+
+    if (fFile)
+        delete fFile;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorStream::Init()
+{
+    // Init the stream event reader.
+
+    // check input
+    if (!fStream || !fStream->good())
+    {
+        G4cout << "A2FileGeneratorStream::Init(): Cannot read from " << fFileName << "!" << G4endl;
+        return false;
+    }
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorStream::ReadEvent(G4int event)
+{
+    // Read the next event from the stream. The event number 'event' is
+    // ignored as streams can only be read sequentially. Return false at the
+    // end of the input.
+
+    // reset event data
+    fPart.clear();
+    fWeight = 1;
+
+    return ParseEvent();
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorStream::ReadLine()
+{
+    // Read the next non-empty line into fLine without leading whitespace.
+    // Return false at the end of the input.
+
+    // return pushed-back line again
+    if (fPushedBack)
+    {
+        fPushedBack = false;
+        return true;
+    }
+
+    while (std::getline(*fStream, fLine))
+    {
+        fBytesRead += fLine.size() + 1;
+
+        // strip leading whitespace
+        size_t start = fLine.find_first_not_of(" \t\r");
+        if (start == std::string::npos)
+            continue;
+        if (start)
+            fLine.erase(0, start);
+
+        return true;
+    }
+
+    fLine.clear();
+    return false;
+}
+
+//______________________________________________________________________________
+void A2FileGeneratorStream::ParseError(const char* what)
+{
+    // Report a parse error of the current line and stop. A corrupt input is
+    // not treated like the end of the input to not silently lose events.
+
+    G4cout << "A2FileGeneratorStream::ParseEvent(): " << what << " in " << fFileName
+           << " before byte " << fBytesRead << "!" << G4endl;
+    if (!fLine.empty())
+        G4cout << "  " << fLine << G4endl;
+    exit(1);
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorStream::AddParticle(G4int pdg, const G4ThreeVector& p, G4double e,
+                                          const G4ThreeVector& x, G4double t)
+{
+    // Add a particle with PDG code 'pdg', momentum 'p' and total energy 'e'
+    // created at the position 'x' (relative to the primary vertex) and the
+    // time 't' to the current event.
+
+    // check particle limit
+    if ((G4int)fPart.size() >= fMaxPart)
+    {
+        if (!fWarnMaxPart)
+        {
+            G4cout << "A2FileGeneratorStream::AddParticle(): Events with more than "
+                   << fMaxPart << " particles are truncated!" << G4endl;
+            fWarnMaxPart = true;
+        }
+        return false;
+    }
+
+    // set event particle
+    A2GenParticle_t part;
+    part.fDef = FindParticle(pdg);
+    part.fP = p;
+    part.fE = e;
+    part.SetCorrectMass();
+    part.fX = fVertex + x;
+    part.fT = t;
+    part.fIsTrack = part.fDef != 0;
+
+    // add event particle
+    fPart.push_back(part);
+
+    return true;
+}
+
+//______________________________________________________________________________
+void A2FileGeneratorStream::SetBeam(G4int pdg, const G4ThreeVector& p, G4double e)
+{
+    // Set the beam particle of the current event.
+
+    fBeam.fDef = FindParticle(pdg);
+    fBeam.fP = p;
+    fBeam.fE = e;
+    fBeam.SetCorrectMass();
+    fBeam.fX = fVertex;
+    fBeam.fIsTrack = false;
+}
+
@@ -1,10 +1,17 @@
 // event generator reading a ROOT TTree
 // Author: Dominik Werthmueller, 2018
 
+#include "RVersion.h"
 #include "TFile.h"
 #include "TTree.h"
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#include "TROOT.h"
+#else
+#include "TThread.h"
+#endif
 
 #include "A2FileGeneratorTree.hh"
+#include "A2BoundedQueue.hh"
 
 //______________________________________________________________________________
 A2FileGeneratorTree::A2FileGeneratorTree(const char* filename, EFileGenType type,
@@ -16,6 +23,17 @@ A2FileGeneratorTree::A2FileGeneratorTree(const char* filename, EFileGenType type
     // init members
     fFile = 0;
     fTree = 0;
+    fCacheSize = 30;
+    fCacheLearning = false;
+    fBranchesDisabled = false;
+    fReadAhead = 0;
+    fStagedEntry = 0;
+    fPrefetch = 0;
+    fPrefetchReader = 0;
+    fPrefetchQueue = 0;
+    fPrefetchThread = 0;
+    fPrefetchEntry = 0;
+    fAsyncBytesRead = 0;
 
     // try to open input file
     fFile = new TFile(fFileName.c_str());
@@ -41,6 +59,9 @@ A2FileGeneratorTree::~A2FileGeneratorTree()
 {
     // Destructor.
 
+    StopPrefetch();
+    if (fPrefetchReader)
+        delete fPrefetchReader;
     if (fTree)
         delete fTree;
     if (fFile)
@@ -55,20 +76,271 @@ G4bool A2FileGeneratorTree::Init()
     // set number of events
     fNEvents = fTree->GetEntries();
 
+    // set up the tree cache (the prefetch reader has its own cache)
+    if (fPrefetch > 0)
+        fTree->SetCacheSize(0);
+    else
+        InitCache();
+
+    // user info
+    if (fReadAhead > 1 && fVerbose)
+        G4cout << "A2FileGeneratorTree::Init(): Reading " << fReadAhead
+               << " events ahead" << G4endl;
+
     return true;
 }
 
+//______________________________________________________________________________
+void A2FileGeneratorTree::InitCache()
+{
+    // Set up the tree cache. Linked branches are added in LinkBranch(), all
+    // other branches read for the first entry are learned by the cache.
+
+    if (fCacheSize > 0)
+    {
+        fTree->SetCacheSize(fCacheSize*1024*1024);
+        fCacheLearning = true;
+    }
+    else
+    {
+        fTree->SetCacheSize(0);
+    }
+}
+
+//______________________________________________________________________________
+void A2FileGeneratorTree::StopCacheLearning()
+{
+    // Stop the learning phase of the tree cache. To be called after the
+    // first entry was read completely.
+
+    if (fCacheLearning)
+    {
+        fTree->StopCacheLearningPhase();
+        fCacheLearning = false;
+    }
+}
+
 //______________________________________________________________________________
 G4bool A2FileGeneratorTree::ReadEvent(G4int event)
 {
-    // Read the event 'event'.
+    // Read the event 'event', either from the prefetch queue, from the
+    // staging buffer or directly from the tree.
+
+    // read from the prefetch queue
+    if (fPrefetch > 0)
+    {
+        // (re)start prefetching if needed
+        if (!fPrefetchThread || event != fPrefetchEntry)
+        {
+            StopPrefetch();
+            if (!StartPrefetch(event))
+                return ReadEvent(event);
+        }
+
+        // take the next event from the queue
+        A2GenEvent_t ev;
+        if (!fPrefetchQueue->Pop(ev))
+            return false;
+        G4ThreeVector vtx = fVertex;
+        LoadEvent(ev);
+        fPrefetchEntry++;
+
+        // finish decoding in the main thread
+        ResolveParticles();
+        if (fGenVertex)
+            ShiftVertex(vtx);
+
+        return true;
+    }
+
+    // read directly from the tree
+    if (fReadAhead <= 1)
+        return ReadEntry(event);
+
+    // refill staging buffer if needed
+    if (fStaged.empty() || event != fStagedEntry)
+    {
+        if (!FillStaging(event))
+            return false;
+    }
+
+    // make the first staged event the current one
+    G4ThreeVector vtx = fVertex;
+    LoadEvent(fStaged.front());
+    fStaged.pop_front();
+    fStagedEntry++;
+
+    // add the vertex generated for this event
+    if (fGenVertex)
+        ShiftVertex(vtx);
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorTree::FillStaging(G4int entry)
+{
+    // Decode the next fReadAhead entries starting at 'entry' into the
+    // staging buffer. Return false if no entry could be read.
+
+    // keep vertex of the current event
+    G4ThreeVector vtx = fVertex;
+
+    // read entries
+    fStaged.clear();
+    fStagedEntry = entry;
+    for (G4int i = entry; i < entry + fReadAhead && i < fNEvents; i++)
+    {
+        // decode relative to a zero vertex if the vertex is generated
+        if (fGenVertex)
+            fVertex.set(0, 0, 0);
+
+        if (!ReadEntry(i))
+            break;
+
+        fStaged.push_back(A2GenEvent_t());
+        SaveEvent(fStaged.back());
+    }
+
+    // restore vertex
+    fVertex = vtx;
+
+    return !fStaged.empty();
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorTree::StartPrefetch(G4int entry)
+{
+    // Start the prefetch thread decoding events starting at the tree entry
+    // 'entry'. Return false if prefetching is not supported.
+
+    // set up the reader of the prefetch thread
+    if (!fPrefetchReader)
+    {
+        // should have been enabled before opening the first ROOT file
+        EnableThreadSupport();
+
+        // create a second reader with its own file and tree
+        fPrefetchReader = CreateReader();
+        if (!fPrefetchReader)
+        {
+            G4cout << "A2FileGeneratorTree::StartPrefetch(): Prefetching is not supported for "
+                   << GetTypeName() << " input!" << G4endl;
+            fPrefetch = 0;
+            InitCache();
+            return false;
+        }
+        fPrefetchReader->SetVerbose(false);
+        fPrefetchReader->SetCacheSize(fCacheSize);
+        fPrefetchReader->SetReadAhead(fReadAhead);
+        fPrefetchReader->Init();
+
+        // the particle table must not be accessed in the prefetch thread
+        fPrefetchReader->FillParticleCache();
+        fPrefetchReader->fAsync = true;
+
+        // user info
+        G4cout << "A2FileGeneratorTree::StartPrefetch(): Prefetching up to "
+               << fPrefetch << " events" << G4endl;
+    }
+
+    // start the thread
+    fPrefetchQueue = new A2BoundedQueue<A2GenEvent_t>(fPrefetch);
+    fPrefetchThread = new std::thread(PrefetchLoop, fPrefetchReader, fPrefetchQueue, entry);
+    fPrefetchEntry = entry;
+
+    return true;
+}
+
+//______________________________________________________________________________
+void A2FileGeneratorTree::EnableThreadSupport()
+{
+    // Enable the thread support of ROOT needed for prefetching. Should be
+    // called before any ROOT file is opened.
+
+    static G4bool rootThreads = false;
+    if (!rootThreads)
+    {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+        ROOT::EnableThreadSafety();
+#else
+        TThread::Initialize();
+#endif
+        rootThreads = true;
+    }
+}
+
+//______________________________________________________________________________
+void A2FileGeneratorTree::StopPrefetch()
+{
+    // Stop the prefetch thread and discard all prefetched events.
+
+    if (fPrefetchThread)
+    {
+        fPrefetchQueue->Close();
+        fPrefetchThread->join();
+        delete fPrefetchThread;
+        fPrefetchThread = 0;
+    }
+    if (fPrefetchQueue)
+    {
+        delete fPrefetchQueue;
+        fPrefetchQueue = 0;
+    }
+}
+
+//______________________________________________________________________________
+void A2FileGeneratorTree::PrefetchLoop(A2FileGeneratorTree* reader,
+                                       A2BoundedQueue<A2GenEvent_t>* queue, G4int entry)
+{
+    // Decode the events starting at the tree entry 'entry' into 'queue' until
+    // the end of the input is reached or the queue is closed. Runs in the
+    // prefetch thread.
+
+    for (G4int i = entry; i < reader->GetNEvents(); i++)
+    {
+        if (!reader->ReadEvent(i))
+            break;
+
+        // the file must not be accessed from the main thread
+        reader->fAsyncBytesRead = reader->fFile->GetBytesRead();
+
+        A2GenEvent_t ev;
+        reader->SaveEvent(ev);
+        if (!queue->Push(ev))
+            return;
+    }
+
+    // signal end of input
+    queue->Close();
+}
+
+//______________________________________________________________________________
+G4bool A2FileGeneratorTree::ReadEntry(G4int entry)
+{
+    // Read the tree entry 'entry'.
 
     // read tree entry
-    fTree->GetEntry(event);
+    fTree->GetEntry(entry);
+
+    // all branches are known to the cache after the first entry
+    StopCacheLearning();
 
     return true;
 }
 
+//______________________________________________________________________________
+G4long A2FileGeneratorTree::GetBytesRead() const
+{
+    // Return the number of bytes read from the input file so far.
+
+    G4long bytes = fFile ? fFile->GetBytesRead() : 0;
+    if (fPrefetchReader)
+        bytes += fPrefetchReader->fAsyncBytesRead;
+
+    return bytes;
+}
+
 //______________________________________________________________________________
 G4bool A2FileGeneratorTree::LinkBranch(const char* bname, void* addr, G4bool verbose)
 {
@@ -81,7 +353,20 @@ G4bool A2FileGeneratorTree::LinkBranch(const char* bname, void* addr, G4bool ver
     // check branch
     if (b)
     {
+        // read only linked branches
+        if (!fBranchesDisabled)
+        {
+            fTree->SetBranchStatus("*", 0);
+            fBranchesDisabled = true;
+        }
+        fTree->SetBranchStatus(bname, 1);
+
         b->SetAddress(addr);
+
+        // add branch to cache
+        if (fCacheLearning)
+            fTree->AddBranchToCache(b, kTRUE);
+
         return true;
     }
     else
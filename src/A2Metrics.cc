@@ -0,0 +1,242 @@
+// Exporter of live run metrics in the Prometheus text format to a file
+// (atomically replaced) or a Unix socket for the monitoring of batch jobs
+// Author: Dominik Werthmueller, 2026
+
+#include <cstdio>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "TFile.h"
+
+#include "A2Metrics.hh"
+#include "A2MetricsMessenger.hh"
+#include "A2Bench.hh"
+
+// not available on all systems (SIGPIPE is then only avoided by the listener)
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+const G4int A2Metrics::kWindow[A2Metrics::kNWindow] = { 60, 300, 900 };
+
+//______________________________________________________________________________
+A2Metrics::A2Metrics()
+{
+    // Constructor.
+
+    // init members
+    fInterval = 10;
+    fJob = "A2Geant4";
+    fEvents = 0;
+    fSteps = 0;
+    fRequested = 0;
+    fSocketWarned = false;
+    fMessenger = new A2MetricsMessenger(this);
+}
+
+//______________________________________________________________________________
+A2Metrics::~A2Metrics()
+{
+    // Destructor.
+
+    delete fMessenger;
+}
+
+//______________________________________________________________________________
+G4double A2Metrics::GetRSS()
+{
+    // Return the current resident set size of the process in MB (the peak
+    // value where /proc is not available).
+
+    std::ifstream in("/proc/self/statm");
+    long pages, resident;
+    if (in >> pages >> resident)
+        return resident * (G4double)sysconf(_SC_PAGESIZE) / 1024. / 1024.;
+    return A2Bench::GetPeakRSS();
+}
+
+//______________________________________________________________________________
+void A2Metrics::BeginOfRun(G4long requested)
+{
+    // Reset the counters for a run of 'requested' events (0 if unknown).
+
+    fEvents = 0;
+    fSteps = 0;
+    fRequested = requested;
+    fStart = Clock_t::now();
+    fLast = fStart;
+    fSamples.clear();
+    A2MetricsSample_t s = { fStart, 0, 0 };
+    fSamples.push_back(s);
+}
+
+//______________________________________________________________________________
+G4String A2Metrics::Format(const TFile* out, G4bool finished) const
+{
+    // Return the snapshot of the metrics in the Prometheus text format.
+    // 'out' is the output file, 'finished' is true at the end of the run.
+
+    Clock_t::time_point now = fSamples.back().fTime;
+    G4double elapsed = std::chrono::duration<G4double>(now - fStart).count();
+    G4String label = "{job=\"" + fJob + "\"}";
+
+    std::ostringstream oss;
+    oss << "# HELP a2_events_total Number of tracked events\n"
+        << "# TYPE a2_events_total counter\n"
+        << "a2_events_total" << label << " " << fEvents << "\n"
+        << "# HELP a2_events_requested Number of requested events (0 if unknown)\n"
+        << "# TYPE a2_events_requested gauge\n"
+        << "a2_events_requested" << label << " " << fRequested << "\n"
+        << "# HELP a2_steps_total Number of steps\n"
+        << "# TYPE a2_steps_total counter\n"
+        << "a2_steps_total" << label << " " << fSteps << "\n";
+
+    // rates over the sliding windows (or the run if it is shorter)
+    oss << "# HELP a2_events_per_second Event rate over a sliding window\n"
+        << "# TYPE a2_events_per_second gauge\n";
+    std::ostringstream steps;
+    steps << "# HELP a2_steps_per_second Step rate over a sliding window\n"
+          << "# TYPE a2_steps_per_second gauge\n";
+    G4double rate = 0;
+    for (G4int w = 0; w < kNWindow; w++)
+    {
+        // oldest sample within the window
+        size_t i = 0;
+        while (i+1 < fSamples.size() &&
+               std::chrono::duration<G4double>(now - fSamples[i].fTime).count() > kWindow[w])
+            i++;
+        G4double dt = std::chrono::duration<G4double>(now - fSamples[i].fTime).count();
+        G4double evRate = dt > 0 ? (fEvents - fSamples[i].fEvents) / dt : 0;
+        G4double stRate = dt > 0 ? (fSteps - fSamples[i].fSteps) / dt : 0;
+        if (w == 0) rate = evRate;
+        oss << "a2_events_per_second{job=\"" << fJob << "\",window=\"" << kWindow[w] << "s\"} " << evRate << "\n";
+        steps << "a2_steps_per_second{job=\"" << fJob << "\",window=\"" << kWindow[w] << "s\"} " << stRate << "\n";
+    }
+    oss << steps.str();
+
+    // estimated time to completion from the rate of the shortest window
+    G4double eta = -1;
+    if (fRequested > 0 && rate > 0)
+        eta = (fRequested - fEvents) / rate;
+    if (finished)
+        eta = 0;
+
+    oss << "# HELP a2_eta_seconds Estimated time to completion (-1 if unknown)\n"
+        << "# TYPE a2_eta_seconds gauge\n"
+        << "a2_eta_seconds" << label << " " << eta << "\n"
+        << "# HELP a2_elapsed_seconds Wall time since the start of the run\n"
+        << "# TYPE a2_elapsed_seconds gauge\n"
+        << "a2_elapsed_seconds" << label << " " << elapsed << "\n"
+        << "# HELP a2_rss_megabytes Resident set size of the process\n"
+        << "# TYPE a2_rss_megabytes gauge\n"
+        << "a2_rss_megabytes" << label << " " << GetRSS() << "\n"
+        << "# HELP a2_output_bytes Bytes written to the output file\n"
+        << "# TYPE a2_output_bytes gauge\n"
+        << "a2_output_bytes" << label << " " << (out ? out->GetBytesWritten() : 0) << "\n"
+        << "# HELP a2_last_update_timestamp_seconds Unix time of this snapshot\n"
+        << "# TYPE a2_last_update_timestamp_seconds gauge\n"
+        << "a2_last_update_timestamp_seconds" << label << " " << std::time(0) << "\n"
+        << "# HELP a2_run_finished 1 if the run has finished\n"
+        << "# TYPE a2_run_finished gauge\n"
+        << "a2_run_finished" << label << " " << (finished ? 1 : 0) << "\n";
+
+    return oss.str();
+}
+
+//______________________________________________________________________________
+G4bool A2Metrics::WriteFile(const G4String& text) const
+{
+    // Replace the metrics file by the snapshot 'text'. The snapshot is
+    // written to a temporary file first and renamed so that readers never
+    // see a partial file.
+
+    G4String tmp = fFile + ".tmp";
+    std::ofstream out(tmp);
+    if (!out.good())
+    {
+        G4cout << "A2Metrics::WriteFile(): Could not open the file " << tmp << "!" << G4endl;
+        return false;
+    }
+    out << text;
+    out.close();
+
+    if (std::rename(tmp.c_str(), fFile.c_str()))
+    {
+        G4cout << "A2Metrics::WriteFile(): Could not rename " << tmp << " to " << fFile << "!" << G4endl;
+        return false;
+    }
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4bool A2Metrics::WriteSocket(const G4String& text)
+{
+    // Send the snapshot 'text' to the listener of the Unix socket. Errors
+    // are reported once, the run is never blocked by a missing listener.
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, fSocket.c_str(), sizeof(addr.sun_path)-1);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return false;
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+
+    G4bool ok = !connect(fd, (struct sockaddr*)&addr, sizeof(addr));
+    if (ok)
+    {
+        size_t sent = 0;
+        while (sent < text.size())
+        {
+            ssize_t n = send(fd, text.c_str() + sent, text.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0)
+            {
+                ok = false;
+                break;
+            }
+            sent += n;
+        }
+    }
+    close(fd);
+
+    if (!ok && !fSocketWarned)
+    {
+        G4cout << "A2Metrics::WriteSocket(): Could not send the metrics to the socket "
+               << fSocket << " (" << strerror(errno) << "), will keep trying" << G4endl;
+        fSocketWarned = true;
+    }
+
+    return ok;
+}
+
+//______________________________________________________________________________
+void A2Metrics::Snapshot(const TFile* out, G4bool finished)
+{
+    // Take a sample of the counters and export the metrics. 'out' is the
+    // output file, 'finished' is true at the end of the run.
+
+    // add the sample, drop samples outside the longest window
+    fLast = Clock_t::now();
+    A2MetricsSample_t s = { fLast, fEvents, fSteps };
+    fSamples.push_back(s);
+    while (fSamples.size() > 2 &&
+           std::chrono::duration<G4double>(fLast - fSamples[1].fTime).count() > kWindow[kNWindow-1])
+        fSamples.pop_front();
+
+    G4String text = Format(out, finished);
+    if (!fFile.empty())
+        WriteFile(text);
+    if (!fSocket.empty())
+        WriteSocket(text);
+}
+
@@ -0,0 +1,67 @@
+#include "A2MetricsMessenger.hh"
+
+#include "A2Metrics.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "CLHEP/Units/SystemOfUnits.h"
+
+
+A2MetricsMessenger::A2MetricsMessenger(A2Metrics* metrics)
+:fMetrics(metrics)
+{
+  fMetricsDir = new G4UIdirectory("/A2/metrics/");
+  fMetricsDir->SetGuidance("Live run metrics in the Prometheus text format");
+
+  fFileCmd = new G4UIcmdWithAString("/A2/metrics/file",this);
+  fFileCmd->SetGuidance("Write the metrics to a file (replaced atomically at every update)");
+  fFileCmd->SetParameterName("file",false);
+  fFileCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fSocketCmd = new G4UIcmdWithAString("/A2/metrics/socket",this);
+  fSocketCmd->SetGuidance("Send the metrics to the listener of a Unix socket");
+  fSocketCmd->SetParameterName("socket",false);
+  fSocketCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fIntervalCmd = new G4UIcmdWithADoubleAndUnit("/A2/metrics/interval",this);
+  fIntervalCmd->SetGuidance("Update interval of the metrics (default 10 s)");
+  fIntervalCmd->SetParameterName("interval",false);
+  fIntervalCmd->SetRange("interval>=0");
+  fIntervalCmd->SetUnitCategory("Time");
+  fIntervalCmd->SetDefaultUnit("s");
+  fIntervalCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fJobCmd = new G4UIcmdWithAString("/A2/metrics/job",this);
+  fJobCmd->SetGuidance("Value of the job label of the metrics (default A2Geant4)");
+  fJobCmd->SetParameterName("job",false);
+  fJobCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+}
+
+
+
+A2MetricsMessenger::~A2MetricsMessenger()
+{
+  delete fMetricsDir;
+  delete fFileCmd;
+  delete fSocketCmd;
+  delete fIntervalCmd;
+  delete fJobCmd;
+}
+
+
+
+void A2MetricsMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
+{
+  if( command == fFileCmd )
+    { fMetrics->SetFile(newValue);}
+
+  if( command == fSocketCmd )
+    { fMetrics->SetSocket(newValue);}
+
+  if( command == fIntervalCmd )
+    { fMetrics->SetInterval(fIntervalCmd->GetNewDoubleValue(newValue)/CLHEP::s);}
+
+  if( command == fJobCmd )
+    { fMetrics->SetJob(newValue);}
+}
+
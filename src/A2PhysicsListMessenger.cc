@@ -43,6 +43,8 @@
 //
 // 
 
+#include <sstream>
+
 #include "A2PhysicsListMessenger.hh"
 
 #include "A2PhysicsList.hh"
@@ -51,6 +53,7 @@
 #include "G4UIcmdWithoutParameter.hh"
 #include "G4UImanager.hh"
 #include "G4UIdirectory.hh"
+#include "G4Exception.hh"
 #include "CLHEP/Units/SystemOfUnits.h"
 
 using namespace CLHEP;
@@ -120,6 +123,25 @@ A2PhysicsListMessenger::A2PhysicsListMessenger(A2PhysicsList* pPhys)
   fRegCmd->SetGuidance("Select region to set cut for");
   fRegCmd->SetParameterName("Region",false);
   fRegCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fBiasXSCmd = new G4UIcmdWithAString("/A2/physics/BiasCrossSection",this);
+  fBiasXSCmd->SetGuidance("Scale the cross section of a process of a particle: particle process factor");
+  fBiasXSCmd->SetGuidance("e.g. 'pi+ pi+Inelastic 10', use 'all' as process to scale all physics processes");
+  fBiasXSCmd->SetGuidance("Only primary particles are biased, secondaries of the same type are not");
+  fBiasXSCmd->SetParameterName("bias",false);
+  fBiasXSCmd->AvailableForStates(G4State_PreInit);
+
+  fCutTableCmd = new G4UIcmdWithAString("/A2/physics/CutTable",this);
+  fCutTableCmd->SetGuidance("Load production cuts and energy thresholds per region from a file");
+  fCutTableCmd->SetGuidance("Format per line: region cut[mm] [energy threshold[MeV]]");
+  fCutTableCmd->SetParameterName("file",false);
+  fCutTableCmd->AvailableForStates(G4State_PreInit,G4State_Init,G4State_Idle);
+
+  fKillCmd = new G4UIcmdWithAString("/A2/physics/KillThreshold",this);
+  fKillCmd->SetGuidance("Stop a particle species below a kinetic energy in a region: region particle energy [unit]");
+  fKillCmd->SetGuidance("e.g. 'CBPassive neutron 1 MeV', the energy is deposited locally");
+  fKillCmd->SetParameterName("threshold",false);
+  fKillCmd->AvailableForStates(G4State_PreInit,G4State_Init,G4State_Idle);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -135,6 +157,9 @@ A2PhysicsListMessenger::~A2PhysicsListMessenger()
   delete fListCmd;
   delete fRegCutCmd;
   delete fRegCmd;
+  delete fBiasXSCmd;
+  delete fCutTableCmd;
+  delete fKillCmd;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -223,6 +248,39 @@ void A2PhysicsListMessenger::SetNewValue(G4UIcommand* command, G4String newValue
     G4cout<<"Selected region "<<fRegion<<G4endl;
   }
 
+  if( command == fBiasXSCmd ) {
+    std::istringstream in(newValue);
+    G4String particle, process;
+    G4double factor;
+    if(in >> particle >> process >> factor && factor > 0) {
+      if(fPhysicsList) fPhysicsList->BiasCrossSection(particle, process, factor);
+    } else {
+      G4cout<<"A2PhysicsListMessenger: expected 'particle process factor' for "
+            <<fBiasXSCmd->GetCommandPath()<<G4endl;
+    }
+  }
+
+  if( command == fCutTableCmd ) {
+    if(fPhysicsList && !fPhysicsList->LoadCutTable(newValue)) {
+      G4ExceptionDescription msg;
+      msg<<"Could not load the cut table "<<newValue;
+      G4Exception("A2PhysicsListMessenger::SetNewValue()","A2Phys001",FatalErrorInArgument,msg);
+    }
+  }
+
+  if( command == fKillCmd ) {
+    std::istringstream in(newValue);
+    G4String region, particle, unit("MeV");
+    G4double ekin;
+    if(in >> region >> particle >> ekin && ekin >= 0) {
+      in >> unit;
+      if(fPhysicsList) fPhysicsList->SetKillThreshold(region, particle, ekin*G4UIcommand::ValueOf(unit));
+    } else {
+      G4cout<<"A2PhysicsListMessenger: expected 'region particle energy [unit]' for "
+            <<fKillCmd->GetCommandPath()<<G4endl;
+    }
+  }
+
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
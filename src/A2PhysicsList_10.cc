@@ -46,10 +46,17 @@
 #include "G4Version.hh"
 #if G4VERSION_NUMBER >= 1000 && G4VERSION_NUMBER < 1030
 
+#include <algorithm>
+
 #include "A2PhysicsList.hh"
 #include "A2PhysicsListMessenger.hh"
+#include "A2BiasingOperator.hh"
+#include "A2RegionCuts.hh"
+
+#include "G4GenericBiasingPhysics.hh"
 
 #include "G4DecayPhysics.hh"
+#include "G4StepLimiterPhysics.hh"
 #include "G4EmStandardPhysics.hh"
 #include "G4EmStandardPhysics_option1.hh"
 #include "G4EmStandardPhysics_option2.hh"
@@ -100,7 +107,8 @@
 
 A2PhysicsList::A2PhysicsList() 
  : G4VModularPhysicsList(),
-   fEmPhysicsList(0), fParticleList(0), fMessenger(0)
+   fEmPhysicsList(0), fParticleList(0), fStepLimiter(0), fMessenger(0),
+   fBiasingPhysics(0), fBiasingOperator(0)
 {
   G4LossTableManager::Instance();
   defaultCutValue = 0.7*mm;
@@ -108,6 +116,9 @@ A2PhysicsList::A2PhysicsList()
   fCutForElectron  = defaultCutValue;
   fCutForPositron  = defaultCutValue;
   fCutForProton    = defaultCutValue;
+
+  // region cuts are opt-in (/A2/physics/CutTable)
+  fRegionCuts = new A2RegionCuts();
   verboseLevel    = 1;
 
   fMessenger = new A2PhysicsListMessenger(this);
@@ -126,7 +137,11 @@ A2PhysicsList::A2PhysicsList()
 A2PhysicsList::~A2PhysicsList()
 {
   delete fMessenger;
+  delete fBiasingPhysics;
+  delete fBiasingOperator;
   delete fParticleList;
+  delete fStepLimiter;
+  delete fRegionCuts;
   delete fEmPhysicsList;
   for(size_t i=0; i<fHadronPhys.size(); i++) {
     delete fHadronPhys[i];
@@ -150,6 +165,39 @@ void A2PhysicsList::ConstructProcess()
   for(size_t i=0; i<fHadronPhys.size(); i++) {
     fHadronPhys[i]->ConstructProcess();
   }
+  // user-limit energy and kill thresholds of the regions
+  if(fRegionCuts->UsesUserLimits()) {
+    // also for neutral particles (gammas, neutrons), default is charged only
+    fStepLimiter = new G4StepLimiterPhysics();
+    fStepLimiter->SetApplyToAll(true);
+    fStepLimiter->ConstructProcess();
+    fRegionCuts->SetLimiterActive(true);
+  }
+  // wrap the biased processes, geometry is already constructed
+  if(fBiasingPhysics) {
+    fBiasingPhysics->ConstructProcess();
+    fBiasingOperator->AttachToAllVolumes();
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void A2PhysicsList::BiasCrossSection(const G4String& particle,
+                                     const G4String& process, G4double factor)
+{
+  if(!fBiasingPhysics) {
+    fBiasingPhysics = new G4GenericBiasingPhysics();
+    fBiasingOperator = new A2BiasingOperator();
+  }
+  // wrap the processes of each particle only once
+  std::vector<G4String> parts = fBiasingOperator->GetParticles();
+  if(std::find(parts.begin(), parts.end(), particle) == parts.end())
+    fBiasingPhysics->Bias(particle);
+  fBiasingOperator->AddBias(particle, process, factor);
+  if (verboseLevel>0) {
+    G4cout << "A2PhysicsList::BiasCrossSection: <" << particle << "> <"
+           << process << "> x" << factor << G4endl;
+  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -348,6 +396,9 @@ void A2PhysicsList::SetCuts()
   SetCutValue(fCutForPositron, "e+");
   SetCutValue(fCutForProton, "proton");
 
+  // region cuts and kill thresholds, the regions exist now
+  fRegionCuts->Apply();
+
   if (verboseLevel>0) { DumpCutValuesTable(); }
 }
 
@@ -399,6 +450,18 @@ void A2PhysicsList::List()
          << G4endl; 
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4String A2PhysicsList::GetPhysicsName() const
+{
+  // names of all physics constructors (e.g. for the physics table cache)
+  G4String name = fParticleList->GetPhysicsName() + " " + fEmPhysicsList->GetPhysicsName();
+  for(size_t i=0; i<fHadronPhys.size(); i++) {
+    name += " " + fHadronPhys[i]->GetPhysicsName();
+  }
+  return name;
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 void A2PhysicsList::SetCutForRegion(G4String reg,G4double cut)
@@ -411,5 +474,25 @@ void A2PhysicsList::SetCutForRegion(G4String reg,G4double cut)
   else G4cout<<"A2PhysicsList::SetCutForRegion region "<<reg<<" not constructed"<<G4endl;
 }
 
-#endif
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void A2PhysicsList::SetRegionCut(const G4String& reg, G4double cut, G4double minEkine)
+{
+  fRegionCuts->SetRegionCut(reg, cut, minEkine);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+G4bool A2PhysicsList::LoadCutTable(const G4String& fileName)
+{
+  return fRegionCuts->LoadCutTable(fileName);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void A2PhysicsList::SetKillThreshold(const G4String& reg, const G4String& particle, G4double ekin)
+{
+  fRegionCuts->SetKillThreshold(reg, particle, ekin);
+}
+
+#endif
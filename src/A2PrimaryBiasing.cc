@@ -0,0 +1,102 @@
+// Importance sampling of generated events: events are kept with a
+// probability given by the importance of the polar-angle regions hit by
+// their tracked particles and weighted with the inverse probability
+// Author: Dominik Werthmueller, 2026
+
+#include "CLHEP/Units/SystemOfUnits.h"
+#include "Randomize.hh"
+
+#include "A2PrimaryBiasing.hh"
+#include "A2PrimaryBiasingMessenger.hh"
+#include "A2FileGenerator.hh"
+
+using namespace CLHEP;
+
+//______________________________________________________________________________
+A2PrimaryBiasing::A2PrimaryBiasing()
+{
+    // Constructor.
+
+    // init members
+    fMaxImportance = 1;
+    fNEvents = 0;
+    fNRejected = 0;
+    fMessenger = new A2PrimaryBiasingMessenger(this);
+}
+
+//______________________________________________________________________________
+A2PrimaryBiasing::~A2PrimaryBiasing()
+{
+    // Destructor.
+
+    delete fMessenger;
+}
+
+//______________________________________________________________________________
+void A2PrimaryBiasing::AddThetaRegion(G4double thetaMin, G4double thetaMax, G4double importance)
+{
+    // Add the polar-angle region from 'thetaMin' to 'thetaMax' with the
+    // importance 'importance'. Events without tracked particles in any
+    // region have the importance 1.
+
+    A2ThetaRegion_t region = { thetaMin, thetaMax, importance };
+    fRegions.push_back(region);
+
+    // update maximum importance
+    if (importance > fMaxImportance)
+        fMaxImportance = importance;
+
+    G4cout << "A2PrimaryBiasing::AddThetaRegion(): Importance " << importance << " for theta "
+           << thetaMin/deg << " - " << thetaMax/deg << " deg" << G4endl;
+}
+
+//______________________________________________________________________________
+void A2PrimaryBiasing::Clear()
+{
+    // Remove all importance regions.
+
+    fRegions.clear();
+    fMaxImportance = 1;
+}
+
+//______________________________________________________________________________
+G4double A2PrimaryBiasing::GetImportance(const A2FileGenerator* gen) const
+{
+    // Return the importance of the current event of the generator 'gen',
+    // i.e. the highest importance of the regions hit by tracked particles.
+
+    G4double imp = 1;
+    for (G4int i = 0; i < gen->GetNParticles(); i++)
+    {
+        if (!gen->IsParticleTrack(i))
+            continue;
+        G4double theta = gen->GetParticleMomentum(i).theta();
+        for (G4int j = 0; j < (G4int)fRegions.size(); j++)
+        {
+            if (theta >= fRegions[j].fThetaMin && theta < fRegions[j].fThetaMax &&
+                fRegions[j].fImportance > imp)
+                imp = fRegions[j].fImportance;
+        }
+    }
+
+    return imp;
+}
+
+//______________________________________________________________________________
+G4bool A2PrimaryBiasing::Select(const A2FileGenerator* gen, G4double& weight)
+{
+    // Decide if the current event of the generator 'gen' is kept. If so,
+    // return true and set the importance weight to 'weight'.
+
+    fNEvents++;
+    G4double p = GetKeepProbability(gen);
+    if (G4UniformRand() >= p)
+    {
+        fNRejected++;
+        return false;
+    }
+    weight = 1. / p;
+
+    return true;
+}
+
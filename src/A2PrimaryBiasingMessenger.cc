@@ -0,0 +1,59 @@
+
+#include <sstream>
+
+#include "A2PrimaryBiasingMessenger.hh"
+
+#include "A2PrimaryBiasing.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithoutParameter.hh"
+#include "CLHEP/Units/SystemOfUnits.h"
+
+
+A2PrimaryBiasingMessenger::A2PrimaryBiasingMessenger(
+                                          A2PrimaryBiasing* biasing)
+:fBiasing(biasing)
+{
+  fBiasDir = new G4UIdirectory("/A2/bias/");
+  fBiasDir->SetGuidance("Event biasing control");
+
+  fThetaRegionCmd = new G4UIcmdWithAString("/A2/bias/ThetaRegion",this);
+  fThetaRegionCmd->SetGuidance("Add a polar-angle importance region: thetaMin thetaMax [deg] importance");
+  fThetaRegionCmd->SetGuidance("Events are kept with probability importance/max. importance and weighted accordingly");
+  fThetaRegionCmd->SetParameterName("region",false);
+  fThetaRegionCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fClearCmd = new G4UIcmdWithoutParameter("/A2/bias/Clear",this);
+  fClearCmd->SetGuidance("Remove all importance regions");
+  fClearCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+}
+
+
+
+A2PrimaryBiasingMessenger::~A2PrimaryBiasingMessenger()
+{
+  delete fBiasDir;
+  delete fThetaRegionCmd;
+  delete fClearCmd;
+}
+
+
+
+void A2PrimaryBiasingMessenger::SetNewValue(
+                                        G4UIcommand* command, G4String newValue)
+{
+  if( command == fThetaRegionCmd )
+    {
+      std::istringstream in(newValue);
+      G4double thetaMin, thetaMax, importance;
+      if (in >> thetaMin >> thetaMax >> importance && thetaMax > thetaMin && importance > 0)
+        fBiasing->AddThetaRegion(thetaMin*CLHEP::deg, thetaMax*CLHEP::deg, importance);
+      else
+        G4cout << "A2PrimaryBiasingMessenger: expected 'thetaMin thetaMax importance' for "
+               << fThetaRegionCmd->GetCommandPath() << G4endl;
+    }
+
+  if( command == fClearCmd )
+    { fBiasing->Clear();}
+}
+
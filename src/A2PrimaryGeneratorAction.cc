@@ -6,10 +6,21 @@
 #include "A2FileGeneratorMkin.hh"
 #include "A2FileGeneratorPluto.hh"
 #include "A2FileGeneratorGiBUU.hh"
+#include "A2FileGeneratorHepMC.hh"
+#include "A2FileGeneratorLHEF.hh"
+#include "A2FileGeneratorBinary.hh"
+#include "A2ReactionGenerator.hh"
+#include "A2TaggedBeam.hh"
+#include "A2VertexSampler.hh"
+#include "A2PrimaryBiasing.hh"
+#include "A2AcceptanceFilter.hh"
 
 #include "G4ParticleGun.hh"
+#include "G4RunManager.hh"
+#include "G4Event.hh"
 #include "Randomize.hh"
 #include "TLorentzVector.h"
+#include "TMath.h"
 #include "TFile.h"
 
 #include "MCNtuple.h"
@@ -28,6 +39,13 @@ A2PrimaryGeneratorAction::A2PrimaryGeneratorAction()
   fGenLorentzVec=NULL;
   fBeamLorentzVec=new TLorentzVector(0,0,0,0);//for beam or interactive events
   fFileGen = 0;
+  fReactionGen = new A2ReactionGenerator();
+  fTaggedBeam = new A2TaggedBeam();
+  fTaggerChannel = -1;
+  fVertexSampler = new A2VertexSampler();
+  fBiasing = new A2PrimaryBiasing();
+  fAcceptance = new A2AcceptanceFilter();
+  fEventWeight = 1;
 
   //default phase space limits
   fTmin=0;
@@ -46,6 +64,7 @@ A2PrimaryGeneratorAction::A2PrimaryGeneratorAction()
 
   //default mode is g4 command line input
   fMode=EPGA_g4;
+  fDryRun=false;
   fNevent=0;
   fNToBeTcount=0;
   fNToBeTracked=0;
@@ -54,6 +73,9 @@ A2PrimaryGeneratorAction::A2PrimaryGeneratorAction()
 
   fDetCon=NULL;
   fInFileName="";
+  fInputCacheSize=30;
+  fInputReadAhead=0;
+  fInputPrefetch=0;
 }
 
 
@@ -71,6 +93,12 @@ A2PrimaryGeneratorAction::~A2PrimaryGeneratorAction()
     delete [] fTrackThis;
   if (fFileGen)
       delete fFileGen;
+  if (fReactionGen)
+      delete fReactionGen;
+  delete fTaggedBeam;
+  delete fVertexSampler;
+  delete fBiasing;
+  delete fAcceptance;
   delete fParticleGun;
   delete fGunMessenger;
   delete fBeamLorentzVec;
@@ -84,6 +112,7 @@ void A2PrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent)
   Float_t Mass;
   Float_t P;
   G4ThreeVector pvec;
+  fEventWeight=1;
   switch(fMode){
   case EPGA_g4:
     if(!fGenLorentzVec)SetMode(EPGA_g4);//in case not called in macro
@@ -109,18 +138,33 @@ void A2PrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent)
   case EPGA_FILE:
     if (fFileGen)
     {
-      // generate vertex for pluto/GiBUU input
+      // generate vertex for pluto/GiBUU/HepMC/LHEF/reaction input
       if (fFileGen->GetType() == A2FileGenerator::kPluto ||
           fFileGen->GetType() == A2FileGenerator::kPlutoCocktail ||
-          fFileGen->GetType() == A2FileGenerator::kGiBUU)
+          fFileGen->GetType() == A2FileGenerator::kGiBUU ||
+          fFileGen->GetType() == A2FileGenerator::kHepMC ||
+          fFileGen->GetType() == A2FileGenerator::kLHEF ||
+          fFileGen->GetType() == A2FileGenerator::kReaction)
       {
-        fFileGen->GenerateVertexCylinder(fDetCon->GetTarget()->GetLength(),
-                                         fDetCon->GetTarget()->GetCenter().z(),
-                                         fBeamDiameter);
+        if (fVertexSampler->IsActive())
+          fFileGen->SetGeneratedVertex(fVertexSampler->SampleCylinder(fDetCon->GetTarget()->GetLength(),
+                                                                      fDetCon->GetTarget()->GetCenter().z(),
+                                                                      fBeamDiameter));
+        else
+          fFileGen->GenerateVertexCylinder(fDetCon->GetTarget()->GetLength(),
+                                           fDetCon->GetTarget()->GetCenter().z(),
+                                           fBeamDiameter);
       }
 
-      // get the event from input tree
-      fFileGen->ReadEvent(fNevent);
+      // get the event from input, end the run at the end of the input
+      if (!fFileGen->ReadEvent(fNevent))
+      {
+        G4cout << "A2PrimaryGeneratorAction::GeneratePrimaries(): End of input reached after "
+               << fNevent << " events" << G4endl;
+        anEvent->SetEventAborted();
+        G4RunManager::GetRunManager()->AbortRun(true);
+        return;
+      }
       //fFileGen->Print();
 
       //
@@ -130,7 +174,10 @@ void A2PrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent)
       // check for first event
       if (fNevent == 0 &&
           fFileGen->GetType() != A2FileGenerator::kPlutoCocktail &&
-          fFileGen->GetType() != A2FileGenerator::kGiBUU)
+          fFileGen->GetType() != A2FileGenerator::kGiBUU &&
+          fFileGen->GetType() != A2FileGenerator::kHepMC &&
+          fFileGen->GetType() != A2FileGenerator::kLHEF &&
+          fFileGen->GetType() != A2FileGenerator::kBinary)
       {
         for (G4int i = 0; i < fFileGen->GetNParticles(); i++)
         {
@@ -192,6 +239,36 @@ void A2PrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent)
           G4cout << "All (stable) particles will be tracked" << G4endl;
       }
 
+      // acceptance pre-filter: skip (or down-weight) events without tracked
+      // particles heading into a detector, the map is built on first use
+      if (fAcceptance->IsActive())
+      {
+        if (!fAcceptance->IsBuilt())
+          fAcceptance->Build(const_cast<G4VPhysicalVolume*>(fDetCon->GetWorld()),
+                             fDetCon->GetTarget()->GetCenter());
+        G4double w;
+        if (!fAcceptance->Select(fFileGen, w))
+        {
+          anEvent->SetEventAborted();
+          fNevent++;
+          return;
+        }
+        fEventWeight *= w;
+      }
+
+      // importance sampling: skip rejected events, weight the kept ones
+      if (fBiasing->IsActive())
+      {
+        G4double w;
+        if (!fBiasing->Select(fFileGen, w))
+        {
+          anEvent->SetEventAborted();
+          fNevent++;
+          return;
+        }
+        fEventWeight *= w;
+      }
+
       //
       // one-time user info
       //
@@ -218,9 +295,19 @@ void A2PrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent)
       else
         fBeamLorentzVec->SetPxPyPzE(beam.fP.x(), beam.fP.y(), beam.fP.z(), beam.fE);
 
-      // set generated 4-vectors to store in output file
-      fNGenParticles = fFileGen->GetNParticles();
-      for (G4int i = 0; i < fFileGen->GetNParticles(); i++)
+      // set tagger channel of the beam photon
+      if (fTaggedBeam->IsLoaded())
+      {
+        if (fFileGen->GetType() == A2FileGenerator::kReaction)
+          fTaggerChannel = static_cast<A2ReactionGenerator*>(fFileGen)->GetTaggerChannel();
+        else
+          fTaggerChannel = fTaggedBeam->FindChannel(fBeamLorentzVec->E());
+      }
+
+      // set generated 4-vectors to store in output file (binary streams
+      // may contain more particles than the output can hold)
+      fNGenParticles = TMath::Min(fFileGen->GetNParticles(), fNGenMaxParticles);
+      for (G4int i = 0; i < fNGenParticles; i++)
       {
 	const G4ThreeVector& mom = fFileGen->GetParticleMomentum(i);
         fGenLorentzVec[i]->SetPxPyPzE(mom.x(), mom.y(), mom.z(), fFileGen->GetParticleEnergy(i));
@@ -283,6 +370,10 @@ void A2PrimaryGeneratorAction::PhaseSpaceGenerator(G4Event* anEvent){
   fBeamLorentzVec->SetXYZM(p3.x(),p3.y(),p3.z(),Mass);
   fGenLorentzVec[0]->SetXYZM(p3.x(),p3.y(),p3.z(),Mass);
   //position vertex
+  if(fVertexSampler->IsActive()){
+    p3=SampleBeamVertex();
+  }
+  else{
   G4float tx=1E10*m;
   G4float ty=1E10*m;
   while(tx*tx+ty*ty>fTargetRadius*fTargetRadius){
@@ -292,6 +383,7 @@ void A2PrimaryGeneratorAction::PhaseSpaceGenerator(G4Event* anEvent){
     p3.setY(ty);
     p3.setZ(fTargetZ0+fTargetThick/2*(2*G4UniformRand()-1));
   }
+  }
 
   fParticleGun->SetParticlePosition(p3);
   fGenPosition[0]=p3.x()/cm;
@@ -305,16 +397,21 @@ void A2PrimaryGeneratorAction::PhaseSpaceGenerator(G4Event* anEvent){
 void A2PrimaryGeneratorAction::OverlapGenerator(G4Event* anEvent){
   //phase space genreator + creates an additional particle at angle fSplitTheta to the first
 
+  G4ThreeVector p3;
+  if(fVertexSampler->IsActive()){
+    p3=SampleBeamVertex();
+  }
+  else{
   G4float tx=1E10*m;
   G4float ty=1E10*m;
   while(tx*tx+ty*ty>fTargetRadius*fTargetRadius){
     tx=G4RandGauss::shoot(0,fBeamXSigma);
     ty=G4RandGauss::shoot(0,fBeamYSigma);
   }
-  G4ThreeVector p3;
   p3.setX(tx);
   p3.setY(ty);
   p3.setZ(fTargetZ0+fTargetThick/2*(2*G4UniformRand()-1));
+  }
   //G4cout<<"PGA "<<fTargetZ0/cm<<" "<<fTargetThick/cm<<" "<<(2*G4UniformRand()-1)<<G4endl;
   fParticleGun->SetParticlePosition(p3);
   fGenPosition[0]=p3.x()/cm;
@@ -351,63 +448,112 @@ void A2PrimaryGeneratorAction::OverlapGenerator(G4Event* anEvent){
 
 }
 void A2PrimaryGeneratorAction::SetUpFileInput(){
-  if(fInFileName==TString(""))return;
-  G4cout<<"A2PrimaryGeneratorAction::SetUpFileInput(): input file set as "<<fInFileName<<G4endl;
+  // use the built-in reaction generator if a reaction but no input file was set
+  G4bool useReaction = fInFileName==TString("") && fReactionGen && fReactionGen->IsDefined();
+  if(fInFileName==TString("") && !useReaction)return;
+  if (useReaction)
+  {
+    if (fTaggedBeam->IsLoaded())
+      fReactionGen->SetTaggedBeam(fTaggedBeam);
+    fFileGen = fReactionGen;
+    fReactionGen = 0;
+  }
+  else
+    G4cout<<"A2PrimaryGeneratorAction::SetUpFileInput(): input file set as "<<fInFileName<<G4endl;
 
   fMode=EPGA_FILE;
 
-  // check for ROOT file
-  if (!fInFileName.EndsWith(".root"))
+  // check for streamed text formats (files, named pipes or stdin via '-')
+  TString streamName(fInFileName);
+  if (streamName.BeginsWith("hepmc:") || streamName.EndsWith(".hepmc") || streamName.EndsWith(".hepmc3"))
   {
-    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Unknown input-file ending!" << G4endl;
-    exit(1);
+    if (streamName.BeginsWith("hepmc:")) streamName.Remove(0, 6);
+    fFileGen = new A2FileGeneratorHepMC(streamName);
   }
-
-  // look for supported event trees in ROOT file
-  TFile* ftest = new TFile(fInFileName);
-  TTree* tree_mkin = 0;
-  TTree* tree_pluto = 0;
-  TTree* tree_gibuu = 0;
-  if (ftest && !ftest->IsZombie())
+  else if (streamName.BeginsWith("lhef:") || streamName.EndsWith(".lhe") || streamName.EndsWith(".lhef"))
   {
-    tree_mkin = (TTree*)ftest->Get("h1");
-    tree_pluto = (TTree*)ftest->Get("data");
-    tree_gibuu = (TTree*)ftest->Get("RootTuple");
-    delete ftest;
+    if (streamName.BeginsWith("lhef:")) streamName.Remove(0, 5);
+    fFileGen = new A2FileGeneratorLHEF(streamName);
   }
-  else
+  else if (streamName.BeginsWith("a2ev:") || streamName.EndsWith(".a2ev"))
   {
-    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Could not open ROOT file " << fInFileName << G4endl;
-    exit(1);
+    if (streamName.BeginsWith("a2ev:")) streamName.Remove(0, 5);
+    fFileGen = new A2FileGeneratorBinary(streamName);
   }
 
-  // open file
-  if (tree_mkin)
+  // check for ROOT file
+  if (!fFileGen && !fInFileName.EndsWith(".root"))
   {
-    fFileGen = new A2FileGeneratorMkin(fInFileName);
+    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Unknown input-file ending!" << G4endl;
+    exit(1);
   }
-  else if (tree_pluto)
+
+  // look for supported event trees in ROOT file
+  if (!fFileGen)
   {
+    TFile* ftest = new TFile(fInFileName);
+    TTree* tree_mkin = 0;
+    TTree* tree_pluto = 0;
+    TTree* tree_gibuu = 0;
+    if (ftest && !ftest->IsZombie())
+    {
+      tree_mkin = (TTree*)ftest->Get("h1");
+      tree_pluto = (TTree*)ftest->Get("data");
+      tree_gibuu = (TTree*)ftest->Get("RootTuple");
+      delete ftest;
+    }
+    else
+    {
+      G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Could not open ROOT file " << fInFileName << G4endl;
+      exit(1);
+    }
+
+    // open file
+    if (tree_mkin)
+    {
+      fFileGen = new A2FileGeneratorMkin(fInFileName);
+    }
+    else if (tree_pluto)
+    {
 #ifdef WITH_PLUTO
-    fFileGen = new A2FileGeneratorPluto(fInFileName);
+      fFileGen = new A2FileGeneratorPluto(fInFileName);
 #else
-    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Support for Pluto event files was not activated at compile time!" << G4endl;
-    exit(1);
+      G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Support for Pluto event files was not activated at compile time!" << G4endl;
+      exit(1);
 #endif
+    }
+    else if (tree_gibuu)
+    {
+      fFileGen = new A2FileGeneratorGiBUU(fInFileName);
+    }
+    else
+    {
+      G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): ROOT event-tree format is not supported!" << G4endl;
+      exit(1);
+    }
   }
-  else if (tree_gibuu)
+
+  // configure reading of ROOT trees
+  A2FileGeneratorTree* treeGen = dynamic_cast<A2FileGeneratorTree*>(fFileGen);
+  if (treeGen)
   {
-    fFileGen = new A2FileGeneratorGiBUU(fInFileName);
+    treeGen->SetCacheSize(fInputCacheSize);
+    treeGen->SetReadAhead(fInputReadAhead);
+    treeGen->SetPrefetch(fInputPrefetch);
   }
-  else
+
+  // configure buffering of binary event streams
+  A2FileGeneratorBinary* binGen = dynamic_cast<A2FileGeneratorBinary*>(fFileGen);
+  if (binGen && fInputPrefetch > 0)
+    binGen->SetBufferSize(fInputPrefetch);
+
+  // init the file
+  if (!fFileGen->Init())
   {
-    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): ROOT event-tree format is not supported!" << G4endl;
+    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Could not initialize the input " << fInFileName << G4endl;
     exit(1);
   }
 
-  // init the file
-  fFileGen->Init();
-
   // user info
   if (fFileGen->GetType() == A2FileGenerator::kMkin)
     G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Opening mkin event-file" << G4endl;
@@ -417,6 +563,14 @@ void A2PrimaryGeneratorAction::SetUpFileInput(){
     G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Opening Pluto cocktail-event file" << G4endl;
   else if (fFileGen->GetType() == A2FileGenerator::kGiBUU)
     G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Opening GiBUU-event file" << G4endl;
+  else if (fFileGen->GetType() == A2FileGenerator::kHepMC)
+    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Opening HepMC3 event stream" << G4endl;
+  else if (fFileGen->GetType() == A2FileGenerator::kLHEF)
+    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Opening LHEF event stream" << G4endl;
+  else if (fFileGen->GetType() == A2FileGenerator::kBinary)
+    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Opening binary event stream" << G4endl;
+  else if (fFileGen->GetType() == A2FileGenerator::kReaction)
+    G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Using built-in reaction generator" << G4endl;
 
   // create data structures for generated particles
   fNGenMaxParticles = fFileGen->GetMaxParticles();
@@ -435,9 +589,11 @@ void A2PrimaryGeneratorAction::SetUpFileInput(){
   }
   else
   {
-    if (fFileGen->GetType() == A2FileGenerator::kPlutoCocktail || fFileGen->GetType() == A2FileGenerator::kGiBUU)
+    if (fFileGen->GetType() == A2FileGenerator::kPlutoCocktail || fFileGen->GetType() == A2FileGenerator::kGiBUU ||
+        fFileGen->GetType() == A2FileGenerator::kHepMC || fFileGen->GetType() == A2FileGenerator::kLHEF ||
+        fFileGen->GetType() == A2FileGenerator::kBinary)
     {
-      G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Particle tracking should not be specified if input is Pluto cocktail!" << G4endl;
+      G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Particle tracking should not be specified if input is Pluto cocktail, GiBUU, HepMC, LHEF or a binary stream!" << G4endl;
       exit(1);
     }
   }
@@ -448,17 +604,103 @@ void A2PrimaryGeneratorAction::SetUpFileInput(){
   }
   if (fFileGen->GetType() == A2FileGenerator::kPluto ||
       fFileGen->GetType() == A2FileGenerator::kPlutoCocktail ||
-      fFileGen->GetType() == A2FileGenerator::kGiBUU)
+      fFileGen->GetType() == A2FileGenerator::kGiBUU ||
+      fFileGen->GetType() == A2FileGenerator::kHepMC ||
+      fFileGen->GetType() == A2FileGenerator::kLHEF ||
+      fFileGen->GetType() == A2FileGenerator::kReaction)
   {
     if (fBeamDiameter == 0)
     {
-      G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Pluto/GiBUU-input requires a beam diameter set via /A2/generator/SetBeamDiameter" << G4endl;
+      G4cout << "A2PrimaryGeneratorAction::SetUpFileInput(): Pluto/GiBUU/HepMC/LHEF/reaction-input requires a beam diameter set via /A2/generator/SetBeamDiameter" << G4endl;
       exit(1);
     }
   }
 
 }
 
+G4ThreeVector A2PrimaryGeneratorAction::SampleBeamVertex(){
+  //vertex for the internal generators using the measured beam spot and/or
+  //target profile, missing parts are generated as in PhaseSpaceGenerator
+  G4double tx=1E10*m;
+  G4double ty=1E10*m;
+  if(fVertexSampler->HasBeamSpot())
+    fVertexSampler->SampleBeamSpot(tx,ty);
+  else{
+    while(tx*tx+ty*ty>fTargetRadius*fTargetRadius){
+      tx=G4RandGauss::shoot(0,fBeamXSigma);
+      ty=G4RandGauss::shoot(0,fBeamYSigma);
+    }
+  }
+  G4double tz;
+  if(fVertexSampler->HasTargetProfile())
+    tz=fTargetZ0+fVertexSampler->SampleTargetProfile();
+  else
+    tz=fTargetZ0+fTargetThick/2*(2*G4UniformRand()-1);
+  return G4ThreeVector(tx,ty,tz);
+}
+
+void A2PrimaryGeneratorAction::SetBeamSpotHist(G4String spec)
+{
+  // load the measured beam-spot histogram
+  if (!fVertexSampler->LoadBeamSpot(spec))
+  {
+    G4cout << "A2PrimaryGeneratorAction::SetBeamSpotHist(): Could not load the beam-spot histogram" << G4endl;
+    exit(1);
+  }
+}
+
+void A2PrimaryGeneratorAction::SetTargetProfileHist(G4String spec)
+{
+  // load the target density profile histogram
+  if (!fVertexSampler->LoadTargetProfile(spec))
+  {
+    G4cout << "A2PrimaryGeneratorAction::SetTargetProfileHist(): Could not load the target-profile histogram" << G4endl;
+    exit(1);
+  }
+}
+
+void A2PrimaryGeneratorAction::SetTaggerFile(TString filename)
+{
+  // load the tagger channels used for the beam photons
+  if (!fTaggedBeam->Load(filename))
+  {
+    G4cout << "A2PrimaryGeneratorAction::SetTaggerFile(): Could not load the tagger file " << filename << G4endl;
+    exit(1);
+  }
+}
+
+void A2PrimaryGeneratorAction::SetInputPrefetch(G4int n)
+{
+  // ROOT thread support must be enabled before the input file is opened
+  fInputPrefetch=n;
+  if (n > 0) A2FileGeneratorTree::EnableThreadSupport();
+}
+
+void A2PrimaryGeneratorAction::SetInputEntry(G4int entry)
+{
+  // continue the input at entry 'entry' (resumed run)
+  fNevent = entry;
+  if (!fFileGen || entry <= 0) return;
+
+  // streams can only be read sequentially, skip the processed events
+  if (fFileGen->GetType() == A2FileGenerator::kHepMC ||
+      fFileGen->GetType() == A2FileGenerator::kLHEF ||
+      fFileGen->GetType() == A2FileGenerator::kBinary)
+  {
+    G4cout << "A2PrimaryGeneratorAction::SetInputEntry(): Skipping " << entry
+           << " events of the input stream" << G4endl;
+    for (G4int i = 0; i < entry; i++)
+    {
+      if (!fFileGen->ReadEvent(i))
+      {
+        G4cout << "A2PrimaryGeneratorAction::SetInputEntry(): End of input reached after "
+               << i << " events" << G4endl;
+        break;
+      }
+    }
+  }
+}
+
 G4int A2PrimaryGeneratorAction::GetNEvents()
 {
   if (fFileGen)
@@ -467,6 +709,20 @@ G4int A2PrimaryGeneratorAction::GetNEvents()
     return -1;
 }
 
+const char* A2PrimaryGeneratorAction::GetModeName()
+{
+  if (fFileGen)
+    return fFileGen->GetTypeName();
+
+  switch (fMode)
+  {
+    case EPGA_g4: return "Particle gun";
+    case EPGA_phase_space: return "Phase space";
+    case EPGA_Overlap: return "Overlap";
+    default: return "Unknown";
+  }
+}
+
 void A2PrimaryGeneratorAction::SetMode(G4int mode)
 {
   fMode=mode;
@@ -6,6 +6,8 @@
 #include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithAnInteger.hh"
 #include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "A2AcceptanceFilter.hh"
 
 #include "Randomize.hh"
 
@@ -27,6 +29,59 @@ A2PrimaryGeneratorMessenger::A2PrimaryGeneratorMessenger(
   SetInput2Cmd->SetParameterName("inputfile",false);
   SetInput2Cmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 
+  SetInputCacheCmd = new G4UIcmdWithAnInteger("/A2/generator/InputCacheSize",this);
+  SetInputCacheCmd->SetGuidance("Set the size of the ROOT input tree cache in MB (0 disables the cache)");
+  SetInputCacheCmd->SetParameterName("size",false);
+  SetInputCacheCmd->SetRange("size>=0");
+  SetInputCacheCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  SetInputReadAheadCmd = new G4UIcmdWithAnInteger("/A2/generator/InputReadAhead",this);
+  SetInputReadAheadCmd->SetGuidance("Set the number of ROOT input events decoded ahead into a staging buffer (0 disables read-ahead)");
+  SetInputReadAheadCmd->SetParameterName("nevents",false);
+  SetInputReadAheadCmd->SetRange("nevents>=0");
+  SetInputReadAheadCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  SetInputPrefetchCmd = new G4UIcmdWithAnInteger("/A2/generator/InputPrefetch",this);
+  SetInputPrefetchCmd->SetGuidance("Set the number of ROOT input events decompressed and decoded in a background thread (0 disables prefetching), or the buffer size for binary event streams");
+  SetInputPrefetchCmd->SetParameterName("nevents",false);
+  SetInputPrefetchCmd->SetRange("nevents>=0");
+  SetInputPrefetchCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  SetTaggerFileCmd = new G4UIcmdWithAString("/A2/generator/TaggerFile",this);
+  SetTaggerFileCmd->SetGuidance("Set the tagger calibration file (channel, energy and width in MeV, optional intensity per line)");
+  SetTaggerFileCmd->SetGuidance("The tagger channel of the beam photon is stored, the reaction generator samples its beam from the tagger");
+  SetTaggerFileCmd->SetParameterName("taggerfile",false);
+  SetTaggerFileCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  SetBeamSpotHistCmd = new G4UIcmdWithAString("/A2/generator/BeamSpotHist",this);
+  SetBeamSpotHistCmd->SetGuidance("Set the measured beam-spot 2D histogram (x/y in mm) used for the vertex: file.root histogram");
+  SetBeamSpotHistCmd->SetParameterName("spec",false);
+  SetBeamSpotHistCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  SetTargetProfileHistCmd = new G4UIcmdWithAString("/A2/generator/TargetProfileHist",this);
+  SetTargetProfileHistCmd->SetGuidance("Set the target density profile 1D histogram (z in mm relative to the target center) used for the vertex: file.root histogram");
+  SetTargetProfileHistCmd->SetParameterName("spec",false);
+  SetTargetProfileHistCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  SetAcceptanceFilterCmd = new G4UIcmdWithAString("/A2/generator/AcceptanceFilter",this);
+  SetAcceptanceFilterCmd->SetGuidance("Pre-filter events on the geometric detector acceptance of the tracked particles");
+  SetAcceptanceFilterCmd->SetGuidance("off: no filter, skip: skip events outside, weight: keep a fraction of them with a weight");
+  SetAcceptanceFilterCmd->SetParameterName("mode",false);
+  SetAcceptanceFilterCmd->SetCandidates("off skip weight");
+  SetAcceptanceFilterCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  SetAcceptanceKeepCmd = new G4UIcmdWithADouble("/A2/generator/AcceptanceKeepFraction",this);
+  SetAcceptanceKeepCmd->SetGuidance("Fraction of events outside the acceptance kept in weight mode");
+  SetAcceptanceKeepCmd->SetParameterName("fraction",false);
+  SetAcceptanceKeepCmd->SetRange("fraction>0 && fraction<=1");
+  SetAcceptanceKeepCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  SetAcceptanceBinsCmd = new G4UIcmdWithAnInteger("/A2/generator/AcceptanceBins",this);
+  SetAcceptanceBinsCmd->SetGuidance("Number of polar-angle bins of the acceptance map (twice as many azimuthal bins)");
+  SetAcceptanceBinsCmd->SetParameterName("nbins",false);
+  SetAcceptanceBinsCmd->SetRange("nbins>0");
+  SetAcceptanceBinsCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   SetNTrackCmd = new G4UIcmdWithAnInteger("/A2/generator/NToBeTracked",this);
   SetNTrackCmd->SetGuidance("Set the number of generated particles to be tracked");
   SetNTrackCmd->SetParameterName("Ntrack",false);
@@ -128,6 +183,15 @@ A2PrimaryGeneratorMessenger::~A2PrimaryGeneratorMessenger()
   delete gunDir;
   delete SetInputCmd;
   delete SetInput2Cmd;
+  delete SetInputCacheCmd;
+  delete SetInputReadAheadCmd;
+  delete SetInputPrefetchCmd;
+  delete SetTaggerFileCmd;
+  delete SetBeamSpotHistCmd;
+  delete SetTargetProfileHistCmd;
+  delete SetAcceptanceFilterCmd;
+  delete SetAcceptanceKeepCmd;
+  delete SetAcceptanceBinsCmd;
   delete SetNTrackCmd;
   delete SetTrackCmd;
   delete SetTminCmd;
@@ -157,6 +221,33 @@ void A2PrimaryGeneratorMessenger::SetNewValue(
   //  { A2Action->SetUpROOTInput(static_cast<TString>(newValue));}
   if( command == SetInput2Cmd )
     {  A2Action->SetInputFile(static_cast<TString>(newValue));A2Action->SetUpFileInput();}//prepare input file in interactive mode
+  if( command == SetInputCacheCmd )
+     { A2Action->SetInputCacheSize(SetInputCacheCmd->GetNewIntValue(newValue));}
+
+  if( command == SetInputReadAheadCmd )
+     { A2Action->SetInputReadAhead(SetInputReadAheadCmd->GetNewIntValue(newValue));}
+
+  if( command == SetInputPrefetchCmd )
+     { A2Action->SetInputPrefetch(SetInputPrefetchCmd->GetNewIntValue(newValue));}
+
+  if( command == SetTaggerFileCmd )
+     { A2Action->SetTaggerFile(static_cast<TString>(newValue));}
+
+  if( command == SetBeamSpotHistCmd )
+     { A2Action->SetBeamSpotHist(newValue);}
+
+  if( command == SetTargetProfileHistCmd )
+     { A2Action->SetTargetProfileHist(newValue);}
+
+  if( command == SetAcceptanceFilterCmd )
+     { A2Action->GetAcceptanceFilter()->SetMode(newValue);}
+
+  if( command == SetAcceptanceKeepCmd )
+     { A2Action->GetAcceptanceFilter()->SetKeepFraction(SetAcceptanceKeepCmd->GetNewDoubleValue(newValue));}
+
+  if( command == SetAcceptanceBinsCmd )
+     { A2Action->GetAcceptanceFilter()->SetNBins(SetAcceptanceBinsCmd->GetNewIntValue(newValue));}
+
   if( command == SetNTrackCmd )
      { A2Action->SetNParticlesToBeTracked(SetNTrackCmd->GetNewIntValue(newValue));}
  
@@ -0,0 +1,269 @@
+// Opt-in profiler of the stepping hot path: step counts, wall time and
+// deposited energy per logical volume, region and particle type
+// Author: Dominik Werthmueller, 2026
+
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+#include "G4LogicalVolume.hh"
+#include "G4Region.hh"
+#include "G4ParticleDefinition.hh"
+#include "TFile.h"
+#include "TTree.h"
+
+#include "A2Profiler.hh"
+#include "A2ProfilerMessenger.hh"
+
+namespace {
+
+// named entry used for sorting and output
+struct A2NamedEntry_t {
+    G4String fName;
+    A2Profiler::A2ProfEntry_t fEntry;
+};
+
+bool CompareTime(const A2NamedEntry_t& a, const A2NamedEntry_t& b)
+{
+    return a.fEntry.fTime > b.fEntry.fTime;
+}
+
+}
+
+//______________________________________________________________________________
+A2Profiler::A2Profiler()
+{
+    // Constructor.
+
+    // init members
+    fEnabled = false;
+    fNPrint = 20;
+    fLastVol = 0;
+    fLastVolEntry = 0;
+    fLastPart = 0;
+    fLastPartEntry = 0;
+    fMessenger = new A2ProfilerMessenger(this);
+}
+
+//______________________________________________________________________________
+A2Profiler::~A2Profiler()
+{
+    // Destructor.
+
+    delete fMessenger;
+}
+
+//______________________________________________________________________________
+void A2Profiler::BeginOfRun()
+{
+    // Reset all counters.
+
+    fVolumes.clear();
+    fParticles.clear();
+    fRegions.clear();
+    fLastVol = 0;
+    fLastVolEntry = 0;
+    fLastPart = 0;
+    fLastPartEntry = 0;
+    fLast = Clock_t::now();
+}
+
+//______________________________________________________________________________
+void A2Profiler::FillRegions()
+{
+    // Sum up the volume counters per region.
+
+    fRegions.clear();
+    for (std::map<const G4LogicalVolume*, A2ProfEntry_t>::const_iterator it = fVolumes.begin();
+         it != fVolumes.end(); ++it)
+    {
+        G4Region* reg = it->first->GetRegion();
+        A2ProfEntry_t& e = fRegions[reg ? reg->GetName() : G4String("none")];
+        e.fSteps += it->second.fSteps;
+        e.fTime += it->second.fTime;
+        e.fEdep += it->second.fEdep;
+    }
+}
+
+//______________________________________________________________________________
+static void SortEntries(const std::map<G4String, A2Profiler::A2ProfEntry_t>& in,
+                        std::vector<A2NamedEntry_t>& out)
+{
+    // Copy the entries of 'in' to 'out' sorted by decreasing time.
+
+    out.clear();
+    for (std::map<G4String, A2Profiler::A2ProfEntry_t>::const_iterator it = in.begin();
+         it != in.end(); ++it)
+    {
+        A2NamedEntry_t e = { it->first, it->second };
+        out.push_back(e);
+    }
+    std::sort(out.begin(), out.end(), CompareTime);
+}
+
+//______________________________________________________________________________
+static void GetSorted(const std::map<const G4LogicalVolume*, A2Profiler::A2ProfEntry_t>& vol,
+                      const std::map<const G4ParticleDefinition*, A2Profiler::A2ProfEntry_t>& part,
+                      const std::map<G4String, A2Profiler::A2ProfEntry_t>& reg,
+                      std::vector<A2NamedEntry_t>& sVol,
+                      std::vector<A2NamedEntry_t>& sReg,
+                      std::vector<A2NamedEntry_t>& sPart)
+{
+    // Return the sorted volume, region and particle entries. Logical
+    // volumes with the same name (e.g. crystals) are summed up.
+
+    std::map<G4String, A2Profiler::A2ProfEntry_t> byName;
+    for (std::map<const G4LogicalVolume*, A2Profiler::A2ProfEntry_t>::const_iterator it = vol.begin();
+         it != vol.end(); ++it)
+    {
+        A2Profiler::A2ProfEntry_t& e = byName[it->first->GetName()];
+        e.fSteps += it->second.fSteps;
+        e.fTime += it->second.fTime;
+        e.fEdep += it->second.fEdep;
+    }
+    SortEntries(byName, sVol);
+    SortEntries(reg, sReg);
+
+    byName.clear();
+    for (std::map<const G4ParticleDefinition*, A2Profiler::A2ProfEntry_t>::const_iterator it = part.begin();
+         it != part.end(); ++it)
+        byName[it->first->GetParticleName()] = it->second;
+    SortEntries(byName, sPart);
+}
+
+//______________________________________________________________________________
+void A2Profiler::EndOfRun()
+{
+    // Summarize the counters of the run.
+
+    FillRegions();
+    Print();
+    if (fJSONFile != "")
+        WriteJSON();
+}
+
+//______________________________________________________________________________
+void A2Profiler::Print() const
+{
+    // Print the profile summary.
+
+    std::vector<A2NamedEntry_t> sVol, sReg, sPart;
+    GetSorted(fVolumes, fParticles, fRegions, sVol, sReg, sPart);
+
+    // total time
+    G4double total = 0;
+    for (size_t i = 0; i < sReg.size(); i++)
+        total += sReg[i].fEntry.fTime;
+    if (total <= 0) total = 1;
+
+    const char* titles[3] = { "Volume", "Region", "Particle" };
+    const std::vector<A2NamedEntry_t>* lists[3] = { &sVol, &sReg, &sPart };
+    G4cout << G4endl << "A2Profiler::Print(): Stepping profile of the run" << G4endl;
+    for (G4int l = 0; l < 3; l++)
+    {
+        G4cout << G4endl
+               << std::setw(24) << std::left << titles[l] << std::right
+               << std::setw(14) << "steps"
+               << std::setw(12) << "time [s]"
+               << std::setw(9) << "time %"
+               << std::setw(14) << "edep [MeV]" << G4endl;
+        for (size_t i = 0; i < lists[l]->size(); i++)
+        {
+            if (l == 0 && (G4int)i == fNPrint) break;
+            const A2NamedEntry_t& e = (*lists[l])[i];
+            G4cout << std::setw(24) << std::left << e.fName << std::right
+                   << std::setw(14) << e.fEntry.fSteps
+                   << std::setw(12) << std::setprecision(4) << e.fEntry.fTime
+                   << std::setw(9) << std::setprecision(3) << 100.*e.fEntry.fTime/total
+                   << std::setw(14) << std::setprecision(6) << e.fEntry.fEdep << G4endl;
+        }
+    }
+    G4cout << std::setprecision(6) << G4endl;
+}
+
+//______________________________________________________________________________
+G4bool A2Profiler::WriteJSON() const
+{
+    // Write the profile summary to the JSON file.
+
+    std::ofstream out(fJSONFile);
+    if (!out.good())
+    {
+        G4cout << "A2Profiler::WriteJSON(): Could not open the file " << fJSONFile << "!" << G4endl;
+        return false;
+    }
+
+    std::vector<A2NamedEntry_t> sVol, sReg, sPart;
+    GetSorted(fVolumes, fParticles, fRegions, sVol, sReg, sPart);
+
+    const char* keys[3] = { "volumes", "regions", "particles" };
+    const std::vector<A2NamedEntry_t>* lists[3] = { &sVol, &sReg, &sPart };
+    out << "{\n";
+    for (G4int l = 0; l < 3; l++)
+    {
+        out << "  \"" << keys[l] << "\": [\n";
+        for (size_t i = 0; i < lists[l]->size(); i++)
+        {
+            const A2NamedEntry_t& e = (*lists[l])[i];
+            out << "    {\"name\": \"" << e.fName << "\""
+                << ", \"steps\": " << e.fEntry.fSteps
+                << ", \"time\": " << e.fEntry.fTime
+                << ", \"edep\": " << e.fEntry.fEdep;
+            if (l == 2)
+                out << ", \"tracks\": " << e.fEntry.fTracks;
+            out << "}" << (i+1 < lists[l]->size() ? "," : "") << "\n";
+        }
+        out << "  ]" << (l < 2 ? "," : "") << "\n";
+    }
+    out << "}\n";
+
+    G4cout << "A2Profiler::WriteJSON(): Profile written to " << fJSONFile << G4endl;
+
+    return true;
+}
+
+//______________________________________________________________________________
+void A2Profiler::WriteTree(TFile* f) const
+{
+    // Write the profile summary as the tree 'A2Profile' to the file 'f'.
+    // The branch 'type' is 0 for volumes, 1 for regions and 2 for particles.
+
+    std::vector<A2NamedEntry_t> sVol, sReg, sPart;
+    GetSorted(fVolumes, fParticles, fRegions, sVol, sReg, sPart);
+
+    Int_t type;
+    Char_t name[256];
+    Long64_t steps, tracks;
+    Double_t time, edep;
+
+    f->cd();
+    TTree* tree = new TTree("A2Profile", "A2Geant4 stepping profile");
+    tree->Branch("type", &type, "type/I");
+    tree->Branch("name", name, "name/C");
+    tree->Branch("steps", &steps, "steps/L");
+    tree->Branch("tracks", &tracks, "tracks/L");
+    tree->Branch("time", &time, "time/D");
+    tree->Branch("edep", &edep, "edep/D");
+
+    const std::vector<A2NamedEntry_t>* lists[3] = { &sVol, &sReg, &sPart };
+    for (type = 0; type < 3; type++)
+    {
+        for (size_t i = 0; i < lists[type]->size(); i++)
+        {
+            const A2NamedEntry_t& e = (*lists[type])[i];
+            strncpy(name, e.fName.c_str(), sizeof(name)-1);
+            name[sizeof(name)-1] = '\0';
+            steps = e.fEntry.fSteps;
+            tracks = e.fEntry.fTracks;
+            time = e.fEntry.fTime;
+            edep = e.fEntry.fEdep;
+            tree->Fill();
+        }
+    }
+
+    tree->Write();
+    delete tree;
+}
+
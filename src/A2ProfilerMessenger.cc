@@ -0,0 +1,58 @@
+
+#include "A2ProfilerMessenger.hh"
+
+#include "A2Profiler.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+
+
+A2ProfilerMessenger::A2ProfilerMessenger(A2Profiler* prof)
+:fProfiler(prof)
+{
+  fProfDir = new G4UIdirectory("/A2/prof/");
+  fProfDir->SetGuidance("Stepping profiler control");
+
+  fEnableCmd = new G4UIcmdWithABool("/A2/prof/enable",this);
+  fEnableCmd->SetGuidance("Profile steps, wall time and deposited energy per volume, region and particle");
+  fEnableCmd->SetParameterName("enable",true);
+  fEnableCmd->SetDefaultValue(true);
+  fEnableCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fJSONCmd = new G4UIcmdWithAString("/A2/prof/json",this);
+  fJSONCmd->SetGuidance("Write the profile summary to a JSON file at the end of the run");
+  fJSONCmd->SetParameterName("file",false);
+  fJSONCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fPrintCmd = new G4UIcmdWithAnInteger("/A2/prof/print",this);
+  fPrintCmd->SetGuidance("Number of volumes printed in the summary (sorted by time)");
+  fPrintCmd->SetParameterName("n",false);
+  fPrintCmd->SetRange("n>=0");
+  fPrintCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+}
+
+
+
+A2ProfilerMessenger::~A2ProfilerMessenger()
+{
+  delete fProfDir;
+  delete fEnableCmd;
+  delete fJSONCmd;
+  delete fPrintCmd;
+}
+
+
+
+void A2ProfilerMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
+{
+  if( command == fEnableCmd )
+    { fProfiler->SetEnabled(fEnableCmd->GetNewBoolValue(newValue));}
+
+  if( command == fJSONCmd )
+    { fProfiler->SetJSONFile(newValue);}
+
+  if( command == fPrintCmd )
+    { fProfiler->SetNPrint(fPrintCmd->GetNewIntValue(newValue));}
+}
+
@@ -0,0 +1,585 @@
+// Built-in reaction event generator: photon beam on a target at rest,
+// N-body phase-space final state and phase-space decay chains.
+// Events are generated in batches with kinematics stored as arrays.
+// Author: Dominik Werthmueller, 2026
+
+#include <sstream>
+
+#include "CLHEP/Units/SystemOfUnits.h"
+#include "CLHEP/Units/PhysicalConstants.h"
+#include "G4ParticleDefinition.hh"
+#include "G4ParticleTable.hh"
+#include "Randomize.hh"
+
+#include "A2ReactionGenerator.hh"
+#include "A2ReactionGeneratorMessenger.hh"
+#include "A2TaggedBeam.hh"
+
+using namespace CLHEP;
+
+//______________________________________________________________________________
+A2ReactionGenerator::A2ReactionGenerator()
+    : A2FileGenerator("", kReaction)
+{
+    // Constructor.
+
+    // init members
+    fTargetName = "proton";
+    fBeamEMin = 0;
+    fBeamEMax = 0;
+    fBeamSpectrum = kBrems;
+    fWeighted = false;
+    fBatchSize = 256;
+    fTaggedBeam = 0;
+    fTargetMass = 0;
+    fBatchPos = 0;
+    fTaggerChannel = -1;
+    fNGenerated = 0;
+    fNAccepted = 0;
+    fMessenger = new A2ReactionGeneratorMessenger(this);
+}
+
+//______________________________________________________________________________
+A2ReactionGenerator::~A2ReactionGenerator()
+{
+    // Destructor.
+
+    // user info
+    if (fVerbose && fNGenerated > 0)
+    {
+        G4cout << "A2ReactionGenerator: " << fNAccepted << " of " << fNGenerated
+               << " generated events accepted" << G4endl;
+    }
+
+    delete fMessenger;
+}
+
+//______________________________________________________________________________
+void A2ReactionGenerator::SetFinalState(const G4String& names)
+{
+    // Set the final-state particles from the list of particle names 'names'.
+
+    fFinalState.clear();
+    std::istringstream in(names);
+    G4String name;
+    while (in >> name)
+        fFinalState.push_back(name);
+}
+
+//______________________________________________________________________________
+void A2ReactionGenerator::AddDecay(const G4String& names)
+{
+    // Add the decay of the first particle in the list of particle names
+    // 'names' into the remaining particles.
+
+    A2Decay_t decay;
+    std::istringstream in(names);
+    G4String name;
+    in >> decay.fParent;
+    while (in >> name)
+        decay.fProducts.push_back(name);
+
+    // replace existing decay of the same particle
+    for (G4int i = 0; i < (G4int)fDecays.size(); i++)
+    {
+        if (fDecays[i].fParent == decay.fParent)
+        {
+            fDecays[i] = decay;
+            return;
+        }
+    }
+    fDecays.push_back(decay);
+}
+
+//______________________________________________________________________________
+G4ParticleDefinition* A2ReactionGenerator::FindParticleByName(const G4String& name) const
+{
+    // Return the particle definition of the particle named 'name'.
+
+    G4ParticleDefinition* def = G4ParticleTable::GetParticleTable()->FindParticle(name);
+    if (!def)
+        G4cout << "A2ReactionGenerator::FindParticleByName(): Unknown particle '" << name << "'!" << G4endl;
+    return def;
+}
+
+//______________________________________________________________________________
+G4bool A2ReactionGenerator::Init()
+{
+    // Init the reaction generator.
+
+    // check final state
+    if (fFinalState.size() < 2)
+    {
+        G4cout << "A2ReactionGenerator::Init(): At least two final-state particles are required!" << G4endl;
+        return false;
+    }
+
+    // take beam energy range from the tagger
+    if (fTaggedBeam)
+    {
+        fBeamEMin = fTaggedBeam->GetEMin();
+        fBeamEMax = fTaggedBeam->GetEMax();
+    }
+
+    // check beam energy
+    if (fBeamEMin <= 0 || fBeamEMax < fBeamEMin)
+    {
+        G4cout << "A2ReactionGenerator::Init(): Invalid beam energy range "
+               << fBeamEMin/MeV << " - " << fBeamEMax/MeV << " MeV!" << G4endl;
+        return false;
+    }
+
+    // target
+    G4ParticleDefinition* target = FindParticleByName(fTargetName);
+    if (!target)
+        return false;
+    fTargetMass = target->GetPDGMass();
+
+    // initial-state stage
+    fSlotDef.clear();
+    fStages.clear();
+    A2Stage_t initial = { -1, 0, (G4int)fFinalState.size() };
+    fStages.push_back(initial);
+    for (G4int i = 0; i < (G4int)fFinalState.size(); i++)
+        fSlotDef.push_back(FindParticleByName(fFinalState[i]));
+
+    // add decay stages of all slots, including the ones of decay products
+    for (G4int s = 0; s < (G4int)fSlotDef.size(); s++)
+    {
+        if (!fSlotDef[s])
+            return false;
+
+        // look for a decay of this particle
+        for (G4int i = 0; i < (G4int)fDecays.size(); i++)
+        {
+            if (fDecays[i].fParent != fSlotDef[s]->GetParticleName())
+                continue;
+
+            // check decay
+            if (fDecays[i].fProducts.size() < 2)
+            {
+                G4cout << "A2ReactionGenerator::Init(): Decay of " << fDecays[i].fParent
+                       << " requires at least two products!" << G4endl;
+                return false;
+            }
+            if (fSlotDef.size() + fDecays[i].fProducts.size() > 1000)
+            {
+                G4cout << "A2ReactionGenerator::Init(): Too many particles, recursive decay of "
+                       << fDecays[i].fParent << "?" << G4endl;
+                return false;
+            }
+
+            // add decay stage
+            A2Stage_t stage = { s, (G4int)fSlotDef.size(), (G4int)fDecays[i].fProducts.size() };
+            fStages.push_back(stage);
+            G4double sum = 0;
+            for (G4int j = 0; j < stage.fN; j++)
+            {
+                G4ParticleDefinition* def = FindParticleByName(fDecays[i].fProducts[j]);
+                if (!def)
+                    return false;
+                fSlotDef.push_back(def);
+                sum += def->GetPDGMass();
+            }
+            if (sum >= fSlotDef[s]->GetPDGMass())
+            {
+                G4cout << "A2ReactionGenerator::Init(): Decay of " << fDecays[i].fParent
+                       << " is kinematically forbidden!" << G4endl;
+                return false;
+            }
+            break;
+        }
+    }
+
+    // slot masses and stable (final) particles
+    G4int nSlots = fSlotDef.size();
+    fSlotMass.resize(nSlots);
+    fSlotStable.assign(nSlots, true);
+    for (G4int s = 0; s < nSlots; s++)
+        fSlotMass[s] = fSlotDef[s]->GetPDGMass();
+    for (G4int i = 1; i < (G4int)fStages.size(); i++)
+        fSlotStable[fStages[i].fParent] = false;
+
+    // check threshold
+    G4double sum = 0;
+    for (G4int i = 0; i < fStages[0].fN; i++)
+        sum += fSlotMass[i];
+    G4double wMax = std::sqrt(fTargetMass*fTargetMass + 2*fBeamEMax*fTargetMass);
+    G4double wMin = std::sqrt(fTargetMass*fTargetMass + 2*fBeamEMin*fTargetMass);
+    if (wMax <= sum)
+    {
+        G4cout << "A2ReactionGenerator::Init(): Reaction threshold is above the maximum beam energy!" << G4endl;
+        return false;
+    }
+    if (wMin <= sum && fVerbose)
+    {
+        G4cout << "A2ReactionGenerator::Init(): Events below the reaction threshold will be rejected" << G4endl;
+    }
+
+    // build reaction description
+    fFileName = "gamma " + fTargetName + " ->";
+    for (G4int i = 0; i < (G4int)fFinalState.size(); i++)
+        fFileName += " " + fFinalState[i];
+    for (G4int i = 0; i < (G4int)fDecays.size(); i++)
+    {
+        fFileName += ", " + fDecays[i].fParent + " ->";
+        for (G4int j = 0; j < (G4int)fDecays[i].fProducts.size(); j++)
+            fFileName += " " + fDecays[i].fProducts[j];
+    }
+
+    // init beam
+    fBeam.fDef = G4ParticleTable::GetParticleTable()->FindParticle("gamma");
+    fBeam.fM = 0;
+    fBeam.fIsTrack = false;
+
+    // init particles
+    fPart.clear();
+    for (G4int s = 0; s < nSlots; s++)
+    {
+        if (!fSlotStable[s])
+            continue;
+        A2GenParticle_t part;
+        part.fDef = fSlotDef[s];
+        part.fM = fSlotMass[s];
+        part.fIsTrack = true;
+        fPart.push_back(part);
+    }
+
+    // allocate batch data
+    if (fBatchSize < 1)
+        fBatchSize = 1;
+    fPx.resize(nSlots*fBatchSize);
+    fPy.resize(nSlots*fBatchSize);
+    fPz.resize(nSlots*fBatchSize);
+    fE.resize(nSlots*fBatchSize);
+    fBeamE.resize(fBatchSize);
+    fBeamCh.assign(fBatchSize, -1);
+    fBatchWeight.resize(fBatchSize);
+    fBatchPos = fBatchSize;
+
+    // number of events is given by the user
+    fNEvents = 0;
+
+    // user info
+    if (fVerbose)
+    {
+        G4cout << "A2ReactionGenerator::Init(): Reaction: " << fFileName << G4endl;
+        if (fTaggedBeam)
+            G4cout << "A2ReactionGenerator::Init(): Beam energy " << fBeamEMin/MeV << " - "
+                   << fBeamEMax/MeV << " MeV (tagger " << fTaggedBeam->GetFileName() << ")" << G4endl;
+        else
+            G4cout << "A2ReactionGenerator::Init(): Beam energy " << fBeamEMin/MeV << " - "
+                   << fBeamEMax/MeV << " MeV (" << (fBeamSpectrum == kFlat ? "flat" : "1/E") << ")" << G4endl;
+        G4cout << "A2ReactionGenerator::Init(): Producing " << (fWeighted ? "weighted" : "unweighted")
+               << " events in batches of " << fBatchSize << G4endl;
+    }
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4double A2ReactionGenerator::PDK(G4double a, G4double b, G4double c)
+{
+    // Return the momentum of the decay products in the two-body decay of a
+    // particle of mass 'a' into particles of mass 'b' and 'c'.
+
+    G4double x = (a-b-c)*(a+b+c)*(a-b+c)*(a+b-c);
+    return x > 0 ? std::sqrt(x) / (2*a) : 0;
+}
+
+//______________________________________________________________________________
+G4double A2ReactionGenerator::SampleBeamEnergy(G4double u) const
+{
+    // Return a beam energy for the uniform random number 'u'.
+
+    if (fBeamSpectrum == kBrems && fBeamEMax > fBeamEMin)
+        return fBeamEMin * std::pow(fBeamEMax/fBeamEMin, u);
+    else
+        return fBeamEMin + u*(fBeamEMax - fBeamEMin);
+}
+
+//______________________________________________________________________________
+void A2ReactionGenerator::GenerateStage(const A2Stage_t& stage)
+{
+    // Generate the phase-space kinematics of the stage 'stage' for all
+    // events of the batch following the GENBOD algorithm (as TGenPhaseSpace).
+    // The phase-space weight of the stage (normalized to a maximum of 1) is
+    // multiplied into the event weights.
+
+    const G4int nb = fBatchSize;
+    const G4int n = stage.fN;
+    const G4double* m = &fSlotMass[stage.fFirst];
+
+    // random numbers: n-2 for the invariant masses, 2 per step for the angles
+    const G4int nRnd = (n-2) + 2*(n-1);
+    fRnd.resize(nRnd*nb);
+    HepRandom::getTheEngine()->flatArray(nRnd*nb, &fRnd[0]);
+    fInvMass.resize(n*nb);
+    fPd.resize(n*nb);
+
+    // sum of the product masses
+    G4double sumMass = 0;
+    for (G4int i = 0; i < n; i++)
+        sumMass += m[i];
+
+    // parent mass and kinetic energy in the parent frame
+    for (G4int k = 0; k < nb; k++)
+    {
+        G4double e, px, py, pz;
+        if (stage.fParent < 0)
+        {
+            e = fBeamE[k] + fTargetMass;
+            px = 0;
+            py = 0;
+            pz = fBeamE[k];
+        }
+        else
+        {
+            G4int idx = stage.fParent*nb + k;
+            e = fE[idx];
+            px = fPx[idx];
+            py = fPy[idx];
+            pz = fPz[idx];
+        }
+        G4double m2 = e*e - px*px - py*py - pz*pz;
+        G4double mp = m2 > 0 ? std::sqrt(m2) : 0;
+        fInvMass[(n-1)*nb + k] = mp;
+        if (mp <= sumMass)
+            fBatchWeight[k] = 0;
+    }
+
+    // sort the random numbers of the invariant masses of each event
+    for (G4int k = 0; k < nb; k++)
+    {
+        for (G4int i = 1; i < n-2; i++)
+        {
+            G4double r = fRnd[i*nb + k];
+            G4int j = i - 1;
+            while (j >= 0 && fRnd[j*nb + k] > r)
+            {
+                fRnd[(j+1)*nb + k] = fRnd[j*nb + k];
+                j--;
+            }
+            fRnd[(j+1)*nb + k] = r;
+        }
+    }
+
+    // intermediate invariant masses
+    G4double sum = m[0];
+    for (G4int k = 0; k < nb; k++)
+        fInvMass[k] = m[0];
+    for (G4int i = 1; i < n-1; i++)
+    {
+        sum += m[i];
+        const G4double* r = &fRnd[(i-1)*nb];
+        const G4double* mp = &fInvMass[(n-1)*nb];
+        G4double* im = &fInvMass[i*nb];
+        for (G4int k = 0; k < nb; k++)
+            im[k] = r[k]*(mp[k] - sumMass) + sum;
+    }
+
+    // momenta in the intermediate frames and weights
+    for (G4int k = 0; k < nb; k++)
+    {
+        G4double teCmTm = fInvMass[(n-1)*nb + k] - sumMass;
+        G4double emMax = teCmTm + m[0];
+        G4double emMin = 0;
+        G4double wtMax = 1;
+        G4double wt = 1;
+        for (G4int i = 1; i < n; i++)
+        {
+            emMin += m[i-1];
+            emMax += m[i];
+            wtMax *= PDK(emMax, emMin, m[i]);
+            G4double pd = PDK(fInvMass[i*nb + k], fInvMass[(i-1)*nb + k], m[i]);
+            fPd[(i-1)*nb + k] = pd;
+            wt *= pd;
+        }
+        fBatchWeight[k] *= wtMax > 0 ? wt / wtMax : 0;
+    }
+
+    // first two products back-to-back along y
+    {
+        const G4double* pd = &fPd[0];
+        G4int s = stage.fFirst*nb;
+        for (G4int k = 0; k < nb; k++)
+        {
+            fPx[s+k] = 0;
+            fPy[s+k] = pd[k];
+            fPz[s+k] = 0;
+            fE[s+k] = std::sqrt(pd[k]*pd[k] + m[0]*m[0]);
+        }
+    }
+
+    // add products one by one, rotating and boosting the previous ones
+    for (G4int i = 1; i < n; i++)
+    {
+        const G4double* pdPrev = &fPd[(i-1)*nb];
+        G4int s = (stage.fFirst+i)*nb;
+        for (G4int k = 0; k < nb; k++)
+        {
+            fPx[s+k] = 0;
+            fPy[s+k] = -pdPrev[k];
+            fPz[s+k] = 0;
+            fE[s+k] = std::sqrt(pdPrev[k]*pdPrev[k] + m[i]*m[i]);
+        }
+
+        // random rotation around z and y
+        const G4double* rz = &fRnd[((n-2) + 2*(i-1))*nb];
+        const G4double* ry = &fRnd[((n-2) + 2*(i-1) + 1)*nb];
+        for (G4int j = 0; j <= i; j++)
+        {
+            G4int sj = (stage.fFirst+j)*nb;
+            for (G4int k = 0; k < nb; k++)
+            {
+                G4double cZ = 2*rz[k] - 1;
+                G4double sZ = std::sqrt(1 - cZ*cZ);
+                G4double angY = twopi*ry[k];
+                G4double cY = std::cos(angY);
+                G4double sY = std::sin(angY);
+                G4double x = fPx[sj+k];
+                G4double y = fPy[sj+k];
+                x = cZ*x - sZ*y;
+                fPy[sj+k] = sZ*fPx[sj+k] + cZ*y;
+                G4double z = fPz[sj+k];
+                fPx[sj+k] = cY*x - sY*z;
+                fPz[sj+k] = sY*x + cY*z;
+            }
+        }
+        if (i == n-1)
+            break;
+
+        // boost along y into the frame of the next intermediate system
+        const G4double* pd = &fPd[i*nb];
+        const G4double* im = &fInvMass[i*nb];
+        for (G4int j = 0; j <= i; j++)
+        {
+            G4int sj = (stage.fFirst+j)*nb;
+            for (G4int k = 0; k < nb; k++)
+            {
+                G4double beta = pd[k] / std::sqrt(pd[k]*pd[k] + im[k]*im[k]);
+                G4double gamma = 1 / std::sqrt(1 - beta*beta);
+                G4double py = fPy[sj+k];
+                G4double e = fE[sj+k];
+                fPy[sj+k] = gamma*(py + beta*e);
+                fE[sj+k] = gamma*(e + beta*py);
+            }
+        }
+    }
+
+    // boost all products into the lab frame
+    for (G4int j = 0; j < n; j++)
+    {
+        G4int sj = (stage.fFirst+j)*nb;
+        for (G4int k = 0; k < nb; k++)
+        {
+            G4double e, bx, by, bz;
+            if (stage.fParent < 0)
+            {
+                e = fBeamE[k] + fTargetMass;
+                bx = 0;
+                by = 0;
+                bz = fBeamE[k] / e;
+            }
+            else
+            {
+                G4int idx = stage.fParent*nb + k;
+                e = fE[idx];
+                bx = fPx[idx] / e;
+                by = fPy[idx] / e;
+                bz = fPz[idx] / e;
+            }
+            G4double b2 = bx*bx + by*by + bz*bz;
+            G4double gamma = 1 / std::sqrt(1 - b2);
+            G4double bp = bx*fPx[sj+k] + by*fPy[sj+k] + bz*fPz[sj+k];
+            G4double gamma2 = b2 > 0 ? (gamma - 1) / b2 : 0;
+            G4double f = gamma2*bp + gamma*fE[sj+k];
+            fPx[sj+k] += f*bx;
+            fPy[sj+k] += f*by;
+            fPz[sj+k] += f*bz;
+            fE[sj+k] = gamma*(fE[sj+k] + bp);
+        }
+    }
+}
+
+//______________________________________________________________________________
+void A2ReactionGenerator::GenerateBatch()
+{
+    // Generate a new batch of events.
+
+    // beam energies
+    if (fTaggedBeam)
+    {
+        // sample tagger channels and energies within the channels
+        fRnd.resize(2*fBatchSize);
+        HepRandom::getTheEngine()->flatArray(2*fBatchSize, &fRnd[0]);
+        for (G4int k = 0; k < fBatchSize; k++)
+            fBeamE[k] = fTaggedBeam->Sample(fRnd[k], fRnd[fBatchSize+k], fBeamCh[k]);
+    }
+    else
+    {
+        HepRandom::getTheEngine()->flatArray(fBatchSize, &fBeamE[0]);
+        for (G4int k = 0; k < fBatchSize; k++)
+            fBeamE[k] = SampleBeamEnergy(fBeamE[k]);
+    }
+    for (G4int k = 0; k < fBatchSize; k++)
+        fBatchWeight[k] = 1;
+
+    // production and decays
+    for (G4int i = 0; i < (G4int)fStages.size(); i++)
+        GenerateStage(fStages[i]);
+
+    fBatchPos = 0;
+}
+
+//______________________________________________________________________________
+G4bool A2ReactionGenerator::ReadEvent(G4int event)
+{
+    // Generate the next event. Unweighted events are selected according to
+    // their phase-space weight, weighted events keep it as event weight.
+
+    // find next accepted event
+    G4int k;
+    for (;;)
+    {
+        if (fBatchPos >= fBatchSize)
+            GenerateBatch();
+        k = fBatchPos++;
+        fNGenerated++;
+
+        // reject events below threshold
+        if (fBatchWeight[k] <= 0)
+            continue;
+
+        // accept-reject
+        if (fWeighted || G4UniformRand() < fBatchWeight[k])
+            break;
+    }
+    fNAccepted++;
+
+    // weight
+    fWeight = fWeighted ? fBatchWeight[k] : 1;
+
+    // beam
+    fBeam.fP.set(0, 0, fBeamE[k]);
+    fBeam.fE = fBeamE[k];
+    fTaggerChannel = fBeamCh[k];
+
+    // particles
+    G4int p = 0;
+    for (G4int s = 0; s < (G4int)fSlotDef.size(); s++)
+    {
+        if (!fSlotStable[s])
+            continue;
+        G4int idx = s*fBatchSize + k;
+        fPart[p].fP.set(fPx[idx], fPy[idx], fPz[idx]);
+        fPart[p].fE = fE[idx];
+        fPart[p].fX = fVertex;
+        fPart[p].fT = 0;
+        fPart[p].fIsTrack = true;
+        p++;
+    }
+
+    return true;
+}
+
@@ -0,0 +1,111 @@
+
+#include "A2ReactionGeneratorMessenger.hh"
+
+#include "A2ReactionGenerator.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithABool.hh"
+
+
+A2ReactionGeneratorMessenger::A2ReactionGeneratorMessenger(
+                                          A2ReactionGenerator* reaction)
+:fReaction(reaction)
+{
+  fReactionDir = new G4UIdirectory("/A2/reaction/");
+  fReactionDir->SetGuidance("Built-in reaction generator control");
+
+  fTargetCmd = new G4UIcmdWithAString("/A2/reaction/Target",this);
+  fTargetCmd->SetGuidance("Set the target particle at rest (e.g. proton, neutron, deuteron, He3, alpha)");
+  fTargetCmd->SetParameterName("target",false);
+  fTargetCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fFinalStateCmd = new G4UIcmdWithAString("/A2/reaction/FinalState",this);
+  fFinalStateCmd->SetGuidance("Set the final-state particles of the reaction (e.g. proton pi0)");
+  fFinalStateCmd->SetGuidance("Defining a final state enables the reaction generator if no input file is given");
+  fFinalStateCmd->SetParameterName("particles",false);
+  fFinalStateCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fDecayCmd = new G4UIcmdWithAString("/A2/reaction/Decay",this);
+  fDecayCmd->SetGuidance("Add a phase-space decay of a particle (e.g. pi0 gamma gamma)");
+  fDecayCmd->SetParameterName("particles",false);
+  fDecayCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fBeamEMinCmd = new G4UIcmdWithADoubleAndUnit("/A2/reaction/BeamEnergyMin",this);
+  fBeamEMinCmd->SetGuidance("Set the minimum photon beam energy");
+  fBeamEMinCmd->SetParameterName("Emin",false);
+  fBeamEMinCmd->SetUnitCategory("Energy");
+  fBeamEMinCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fBeamEMaxCmd = new G4UIcmdWithADoubleAndUnit("/A2/reaction/BeamEnergyMax",this);
+  fBeamEMaxCmd->SetGuidance("Set the maximum photon beam energy");
+  fBeamEMaxCmd->SetParameterName("Emax",false);
+  fBeamEMaxCmd->SetUnitCategory("Energy");
+  fBeamEMaxCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fBeamSpectrumCmd = new G4UIcmdWithAString("/A2/reaction/BeamSpectrum",this);
+  fBeamSpectrumCmd->SetGuidance("Set the photon beam energy spectrum");
+  fBeamSpectrumCmd->SetGuidance("  Choice : flat, brems (1/E, default)");
+  fBeamSpectrumCmd->SetParameterName("spectrum",false);
+  fBeamSpectrumCmd->SetCandidates("flat brems");
+  fBeamSpectrumCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fWeightedCmd = new G4UIcmdWithABool("/A2/reaction/Weighted",this);
+  fWeightedCmd->SetGuidance("Produce weighted events instead of unweighted (accept-reject) events");
+  fWeightedCmd->SetParameterName("weighted",true);
+  fWeightedCmd->SetDefaultValue(true);
+  fWeightedCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fBatchSizeCmd = new G4UIcmdWithAnInteger("/A2/reaction/BatchSize",this);
+  fBatchSizeCmd->SetGuidance("Set the number of events generated per batch");
+  fBatchSizeCmd->SetParameterName("nevents",false);
+  fBatchSizeCmd->SetRange("nevents>0");
+  fBatchSizeCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+}
+
+
+
+A2ReactionGeneratorMessenger::~A2ReactionGeneratorMessenger()
+{
+  delete fReactionDir;
+  delete fTargetCmd;
+  delete fFinalStateCmd;
+  delete fDecayCmd;
+  delete fBeamEMinCmd;
+  delete fBeamEMaxCmd;
+  delete fBeamSpectrumCmd;
+  delete fWeightedCmd;
+  delete fBatchSizeCmd;
+}
+
+
+
+void A2ReactionGeneratorMessenger::SetNewValue(
+                                        G4UIcommand* command, G4String newValue)
+{
+  if( command == fTargetCmd )
+    { fReaction->SetTarget(newValue);}
+
+  if( command == fFinalStateCmd )
+    { fReaction->SetFinalState(newValue);}
+
+  if( command == fDecayCmd )
+    { fReaction->AddDecay(newValue);}
+
+  if( command == fBeamEMinCmd )
+    { fReaction->SetBeamEnergyMin(fBeamEMinCmd->GetNewDoubleValue(newValue));}
+
+  if( command == fBeamEMaxCmd )
+    { fReaction->SetBeamEnergyMax(fBeamEMaxCmd->GetNewDoubleValue(newValue));}
+
+  if( command == fBeamSpectrumCmd )
+    { fReaction->SetBeamSpectrum(newValue == "flat" ? A2ReactionGenerator::kFlat : A2ReactionGenerator::kBrems);}
+
+  if( command == fWeightedCmd )
+    { fReaction->SetWeighted(fWeightedCmd->GetNewBoolValue(newValue));}
+
+  if( command == fBatchSizeCmd )
+    { fReaction->SetBatchSize(fBatchSizeCmd->GetNewIntValue(newValue));}
+}
+
@@ -0,0 +1,245 @@
+// Production cuts, energy thresholds and kill thresholds per region, kept
+// until the regions are constructed and shared by all physics list versions
+// Author: Dominik Werthmueller, 2026
+
+#include <fstream>
+#include <sstream>
+
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4ProductionCuts.hh"
+#include "G4ParticleTable.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4UserSpecialCuts.hh"
+#include "G4StateManager.hh"
+#include "CLHEP/Units/SystemOfUnits.h"
+
+#include "A2RegionCuts.hh"
+#include "A2UserLimits.hh"
+
+using namespace CLHEP;
+
+//______________________________________________________________________________
+A2RegionCuts::A2RegionCuts()
+{
+    // Constructor.
+
+    // init members
+    fLimiterActive = false;
+    fVerbose = 1;
+}
+
+//______________________________________________________________________________
+void A2RegionCuts::SetRegionCut(const G4String& reg, G4double cut, G4double minEkine)
+{
+    // Set the production cut 'cut' and the energy threshold 'minEkine' (0 to
+    // disable) of the region 'reg'. Applied directly if the region is
+    // already constructed, otherwise in Apply().
+
+    // replace an existing entry of the region
+    size_t i = 0;
+    while (i < fCuts.size() && fCuts[i].fRegion != reg)
+        i++;
+    if (i == fCuts.size())
+        fCuts.push_back(A2RegionCut_t());
+    fCuts[i].fRegion = reg;
+    fCuts[i].fCut = cut;
+    fCuts[i].fMinEkine = minEkine;
+
+    ApplyRegionCut(i);
+}
+
+//______________________________________________________________________________
+void A2RegionCuts::SetKillThreshold(const G4String& reg, const G4String& particle, G4double ekin)
+{
+    // Stop the particle 'particle' below the kinetic energy 'ekin' in the
+    // region 'reg'. Applied directly if the region is already constructed,
+    // otherwise in Apply().
+
+    // replace an existing entry of the region and particle
+    size_t i = 0;
+    while (i < fKillThresholds.size() &&
+           (fKillThresholds[i].fRegion != reg || fKillThresholds[i].fParticle != particle))
+        i++;
+    if (i == fKillThresholds.size())
+        fKillThresholds.push_back(A2KillThreshold_t());
+    fKillThresholds[i].fRegion = reg;
+    fKillThresholds[i].fParticle = particle;
+    fKillThresholds[i].fEkin = ekin;
+
+    ApplyKillThreshold(i);
+}
+
+//______________________________________________________________________________
+G4bool A2RegionCuts::LoadCutTable(const G4String& fileName)
+{
+    // Load the production cuts and energy thresholds of the file 'fileName'.
+    // Format per line: region cut[mm] [energy threshold[MeV]], '#' starts a
+    // comment. Return false if the file could not be read.
+
+    std::ifstream in(fileName);
+    if (!in.good())
+    {
+        G4cout << "A2RegionCuts::LoadCutTable(): Could not open the cut table "
+               << fileName << "!" << G4endl;
+        return false;
+    }
+
+    std::string line;
+    G4int nLine = 0;
+    while (std::getline(in, line))
+    {
+        nLine++;
+
+        // strip comments
+        size_t pos = line.find('#');
+        if (pos != std::string::npos)
+            line.erase(pos);
+
+        // read region, cut and optional threshold
+        std::istringstream is(line);
+        G4String reg;
+        G4double cut, minEkine = 0;
+        if (!(is >> reg))
+            continue;
+        if (!(is >> cut) || cut <= 0)
+        {
+            G4cout << "A2RegionCuts::LoadCutTable(): Invalid line " << nLine
+                   << " in " << fileName << "!" << G4endl;
+            return false;
+        }
+        is >> minEkine;
+        SetRegionCut(reg, cut*mm, minEkine*MeV);
+    }
+
+    return true;
+}
+
+//______________________________________________________________________________
+void A2RegionCuts::Apply()
+{
+    // Apply all cuts and thresholds to the constructed regions.
+
+    for (size_t i = 0; i < fCuts.size(); i++)
+        ApplyRegionCut(i);
+    for (size_t i = 0; i < fKillThresholds.size(); i++)
+        ApplyKillThreshold(i);
+}
+
+//______________________________________________________________________________
+G4bool A2RegionCuts::UsesUserLimits() const
+{
+    // Return true if energy or kill thresholds are set, i.e. the user limits
+    // have to be applied by the physics list.
+
+    if (!fKillThresholds.empty())
+        return true;
+    for (size_t i = 0; i < fCuts.size(); i++)
+        if (fCuts[i].fMinEkine > 0)
+            return true;
+
+    return false;
+}
+
+//______________________________________________________________________________
+void A2RegionCuts::ApplyRegionCut(size_t i)
+{
+    // Apply the production cut and energy threshold 'i'.
+
+    const A2RegionCut_t& rc = fCuts[i];
+    G4Region* region = G4RegionStore::GetInstance()->GetRegion(rc.fRegion, false);
+
+    // detector not used (yet)
+    if (!region)
+        return;
+
+    // production cut
+    G4ProductionCuts* pcuts = region->GetProductionCuts();
+    if (!pcuts)
+    {
+        pcuts = new G4ProductionCuts();
+        region->SetProductionCuts(pcuts);
+    }
+    pcuts->SetProductionCut(rc.fCut);
+
+    // energy threshold
+    if (rc.fMinEkine > 0)
+        GetRegionLimits(region)->SetUserMinEkine(rc.fMinEkine);
+
+    // user info
+    if (fVerbose > 0)
+        G4cout << "A2RegionCuts::ApplyRegionCut(): Region " << rc.fRegion << ": cut "
+               << rc.fCut/mm << " mm, energy threshold " << rc.fMinEkine/MeV << " MeV" << G4endl;
+}
+
+//______________________________________________________________________________
+void A2RegionCuts::ApplyKillThreshold(size_t i)
+{
+    // Apply the kill threshold 'i'.
+
+    const A2KillThreshold_t& kt = fKillThresholds[i];
+    G4Region* region = G4RegionStore::GetInstance()->GetRegion(kt.fRegion, false);
+
+    // detector not used (yet)
+    if (!region)
+        return;
+
+    // set threshold
+    G4ParticleDefinition* def = G4ParticleTable::GetParticleTable()->FindParticle(kt.fParticle);
+    if (!def)
+    {
+        G4cout << "A2RegionCuts::ApplyKillThreshold(): Unknown particle "
+               << kt.fParticle << "!" << G4endl;
+        return;
+    }
+    GetRegionLimits(region)->SetMinEkine(def, kt.fEkin);
+
+    // check that the threshold is enforced for this particle
+    if (fLimiterActive && !HasSpecialCuts(def))
+        G4cout << "A2RegionCuts::ApplyKillThreshold(): No user special cuts for "
+               << kt.fParticle << ", the threshold has no effect!" << G4endl;
+
+    // user info
+    if (fVerbose > 0)
+        G4cout << "A2RegionCuts::ApplyKillThreshold(): Region " << kt.fRegion << ": "
+               << kt.fParticle << " below " << kt.fEkin/MeV << " MeV are stopped" << G4endl;
+}
+
+//______________________________________________________________________________
+A2UserLimits* A2RegionCuts::GetRegionLimits(G4Region* region)
+{
+    // Return the user limits of the region 'region', create them if needed.
+
+    // user limits are only applied if set before the initialization
+    if (!fLimiterActive && G4StateManager::GetStateManager()->GetCurrentState() == G4State_Idle)
+        G4cout << "A2RegionCuts::GetRegionLimits(): Energy thresholds of region "
+               << region->GetName() << " need to be set before the initialization!" << G4endl;
+
+    A2UserLimits* limits = dynamic_cast<A2UserLimits*>(region->GetUserLimits());
+    if (!limits)
+    {
+        limits = new A2UserLimits();
+        region->SetUserLimits(limits);
+    }
+
+    return limits;
+}
+
+//______________________________________________________________________________
+G4bool A2RegionCuts::HasSpecialCuts(G4ParticleDefinition* def)
+{
+    // Return true if the particle 'def' has the G4UserSpecialCuts process
+    // stopping it below the energy threshold of the user limits.
+
+    G4ProcessManager* pm = def->GetProcessManager();
+    if (!pm)
+        return false;
+
+    G4ProcessVector* procs = pm->GetProcessList();
+    for (G4int i = 0; i < (G4int)procs->size(); i++)
+        if (dynamic_cast<G4UserSpecialCuts*>((*procs)[i]))
+            return true;
+
+    return false;
+}
@@ -1,21 +1,38 @@
 
 #include "A2RunAction.hh"
+#include "A2SteppingAction.hh"
+#include "A2Profiler.hh"
+#include "A2Bench.hh"
+#include "A2StackingAction.hh"
+#include "A2Watchdog.hh"
+#include "A2Metrics.hh"
 
 #include "G4Run.hh"
 #include "G4RunManager.hh"
 #include "G4UnitsTable.hh"
 
+#include <climits>
+
 
 
 A2RunAction::A2RunAction()
 {
   fEventAction=NULL;
+  fProfiler=new A2Profiler();
+  fBench=NULL;
+  fWatchdog=new A2Watchdog();
+  fMetrics=new A2Metrics();
 }
 
 
 
 A2RunAction::~A2RunAction()
-{}
+{
+  delete fProfiler;
+  if(fBench) delete fBench;
+  delete fWatchdog;
+  delete fMetrics;
+}
 
 
 
@@ -29,6 +46,24 @@ void A2RunAction::BeginOfRunAction(const G4Run* aRun)
   //Open output file
   fEventAction=  const_cast<A2EventAction*>(static_cast<const A2EventAction*>(G4RunManager::GetRunManager()->GetUserEventAction()));
   fEventAction->PrepareOutput();
+  fEventAction->BeginOfRun();
+
+  //cache particle and process pointers used in the stepping action, set the profiler, benchmark and watchdog
+  A2SteppingAction* steppingAction = const_cast<A2SteppingAction*>(static_cast<const A2SteppingAction*>(G4RunManager::GetRunManager()->GetUserSteppingAction()));
+  if(steppingAction) steppingAction->BeginOfRun(fProfiler->IsEnabled() ? fProfiler : 0, fBench,
+                                                fWatchdog->IsEnabled() ? fWatchdog : 0);
+  if(fProfiler->IsEnabled()) fProfiler->BeginOfRun();
+  if(fBench) fBench->BeginOfRun();
+  if(fWatchdog->IsEnabled()) fWatchdog->BeginOfRun();
+  if(fMetrics->IsEnabled()){
+    //streamed input runs until the end of the input
+    G4int nReq=aRun->GetNumberOfEventToBeProcessed();
+    fMetrics->BeginOfRun(nReq < INT_MAX ? nReq : 0);
+  }
+
+  //resolve passive regions and reset the kill counts of the stacking action
+  A2StackingAction* stackingAction = const_cast<A2StackingAction*>(static_cast<const A2StackingAction*>(G4RunManager::GetRunManager()->GetUserStackingAction()));
+  if(stackingAction) stackingAction->BeginOfRun();
 }
 
 
@@ -39,7 +74,14 @@ void A2RunAction::EndOfRunAction(const G4Run* aRun)
   G4int NbOfEvents = aRun->GetNumberOfEvent();
   if (NbOfEvents == 0) return;
 
+  if(fBench) fBench->EndOfRun(NbOfEvents);
+  fEventAction->PrintInputSummary(NbOfEvents);
+  const A2StackingAction* stackingAction = static_cast<const A2StackingAction*>(G4RunManager::GetRunManager()->GetUserStackingAction());
+  if(stackingAction) stackingAction->EndOfRun();
+  if(fProfiler->IsEnabled()) fProfiler->EndOfRun();
+  if(fMetrics->IsEnabled()) fMetrics->EndOfRun(fEventAction->GetOutFile());
   fEventAction->CloseOutput();
+  if(fBench) fBench->Write(fEventAction->GetOutFileName().Data());
 
 }
 
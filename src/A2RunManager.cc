@@ -0,0 +1,357 @@
+// Run manager with a startup report: wall time of the initialization
+// phases (materials, detector setup, geometry, physics tables, ...)
+// and the settings of the persistent physics table and geometry caches
+// Author: Dominik Werthmueller, 2026
+
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cerrno>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "G4Version.hh"
+#include "G4VUserPhysicsList.hh"
+#include "G4ParticleTable.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4RegionStore.hh"
+#include "G4ProductionCuts.hh"
+#include "G4ProductionCutsTable.hh"
+#include "G4Material.hh"
+#include "G4EmParameters.hh"
+
+#include "A2RunManager.hh"
+#include "A2RunManagerMessenger.hh"
+#include "A2PhysicsList.hh"
+
+//______________________________________________________________________________
+A2RunManager::A2RunManager()
+    : G4RunManager()
+{
+    // Constructor.
+
+    // init members
+    fStart = Clock_t::now();
+    fReported = false;
+    fMessenger = new A2RunManagerMessenger(this);
+}
+
+//______________________________________________________________________________
+A2RunManager::~A2RunManager()
+{
+    // Destructor.
+
+    delete fMessenger;
+}
+
+//______________________________________________________________________________
+void A2RunManager::InitializeGeometry()
+{
+    // Overwrite InitializeGeometry(): time the detector construction.
+
+    BeginPhase("geometry");
+    G4RunManager::InitializeGeometry();
+    EndPhase();
+}
+
+//______________________________________________________________________________
+void A2RunManager::InitializePhysics()
+{
+    // Overwrite InitializePhysics(): time the process construction.
+
+    BeginPhase("physics processes");
+    G4RunManager::InitializePhysics();
+    EndPhase();
+}
+
+//______________________________________________________________________________
+void A2RunManager::RunInitialization()
+{
+    // Overwrite RunInitialization(): retrieve the physics tables of the
+    // first run from the cache or store them in it after building, time the
+    // physics tables and print the startup report.
+
+    if (fReported)
+    {
+        G4RunManager::RunInitialization();
+        return;
+    }
+
+    BeginPhase("physics tables, begin of run");
+    G4String dir, key;
+    G4bool store = PreparePhysicsTableCache(dir, key);
+    G4RunManager::RunInitialization();
+    EndPhase();
+
+    // store new tables, later rebuilds (e.g. changed cuts) do not use the cache
+    if (store)
+        StorePhysicsTableCache(dir, key);
+    if (!fPhysicsCacheDir.empty())
+        physicsList->ResetPhysicsTableRetrieved();
+
+    PrintStartupReport();
+}
+
+//______________________________________________________________________________
+G4String A2RunManager::GetPhysicsTableKey() const
+{
+    // Return the text describing everything the physics tables depend on:
+    // Geant4 version, physics constructors, EM parameters, processes per
+    // particle, production cuts per region and the materials.
+
+    std::ostringstream key;
+    key << std::setprecision(10);
+
+    // versions and physics list
+    key << G4Version << "\n";
+    const A2PhysicsList* pl = dynamic_cast<const A2PhysicsList*>(physicsList);
+    if (pl)
+        key << "physics " << pl->GetPhysicsName() << "\n";
+#if G4VERSION_NUMBER >= 1020
+    key << *G4EmParameters::Instance();
+#endif
+
+    // processes
+    G4ParticleTable::G4PTblDicIterator* it = G4ParticleTable::GetParticleTable()->GetIterator();
+    it->reset();
+    while ((*it)())
+    {
+        G4ParticleDefinition* part = it->value();
+        G4ProcessManager* pm = part->GetProcessManager();
+        if (!pm)
+            continue;
+        G4ProcessVector* procs = pm->GetProcessList();
+        key << "particle " << part->GetParticleName() << ":";
+        for (G4int i = 0; i < (G4int)procs->size(); i++)
+            key << " " << (*procs)[i]->GetProcessName();
+        key << "\n";
+    }
+
+    // production cuts
+    G4ProductionCutsTable* cutsTable = G4ProductionCutsTable::GetProductionCutsTable();
+    key << "energy range " << cutsTable->GetLowEdgeEnergy() << " "
+        << cutsTable->GetHighEdgeEnergy() << "\n";
+    G4RegionStore* regions = G4RegionStore::GetInstance();
+    for (size_t i = 0; i < regions->size(); i++)
+    {
+        G4Region* region = (*regions)[i];
+        key << "region " << region->GetName() << ":";
+        G4ProductionCuts* cuts = region->GetProductionCuts();
+        if (cuts)
+            for (G4int j = 0; j < 4; j++)
+                key << " " << cuts->GetProductionCut(j);
+        key << "\n";
+    }
+
+    // materials
+    const G4MaterialTable* materials = G4Material::GetMaterialTable();
+    for (size_t i = 0; i < materials->size(); i++)
+    {
+        const G4Material* mat = (*materials)[i];
+        key << "material " << mat->GetName() << ": " << mat->GetDensity() << " "
+            << mat->GetState() << " " << mat->GetTemperature() << " " << mat->GetPressure();
+        const G4double* frac = mat->GetFractionVector();
+        for (size_t j = 0; j < mat->GetNumberOfElements(); j++)
+            key << " " << mat->GetElement(j)->GetName() << " " << mat->GetElement(j)->GetZ()
+                << " " << mat->GetElement(j)->GetN() << " " << frac[j];
+        key << "\n";
+    }
+
+    return key.str();
+}
+
+//______________________________________________________________________________
+G4bool A2RunManager::PreparePhysicsTableCache(G4String& dir, G4String& key)
+{
+    // Look for physics tables matching the current setup in the cache and
+    // let the physics list retrieve them. 'dir' and 'key' are set to the
+    // cache entry. Return true if the tables should be stored after building.
+
+    if (fPhysicsCacheDir.empty())
+        return false;
+
+    key = GetPhysicsTableKey();
+    dir = fPhysicsCacheDir + "/" + Hash(key);
+
+    // check cache entry, the key file is written last
+    std::ifstream in(dir + "/key.txt");
+    if (!in.good())
+    {
+        G4cout << "A2RunManager::PreparePhysicsTableCache(): No cached physics tables in "
+               << dir << ", building them" << G4endl;
+        return true;
+    }
+    std::stringstream cached;
+    cached << in.rdbuf();
+    if (cached.str() != key)
+    {
+        G4cout << "A2RunManager::PreparePhysicsTableCache(): Key mismatch of the cached physics tables in "
+               << dir << ", building them" << G4endl;
+        return false;
+    }
+
+    // retrieve (the physics list falls back to building on failure)
+    G4cout << "A2RunManager::PreparePhysicsTableCache(): Retrieving physics tables from "
+           << dir << G4endl;
+    physicsList->SetPhysicsTableRetrieved(dir);
+
+    return false;
+}
+
+//______________________________________________________________________________
+void A2RunManager::StorePhysicsTableCache(const G4String& dir, const G4String& key)
+{
+    // Store the built physics tables with their key in the cache entry 'dir'.
+    // The tables are written to a temporary directory that is renamed so
+    // that concurrent jobs never see incomplete entries.
+
+    std::ostringstream tmp;
+    tmp << dir << ".tmp" << getpid();
+    if (!MakeDir(fPhysicsCacheDir) || !MakeDir(tmp.str()))
+    {
+        G4cout << "A2RunManager::StorePhysicsTableCache(): Could not create the directory "
+               << tmp.str() << "!" << G4endl;
+        return;
+    }
+
+    // tables and key
+    G4bool ok = physicsList->StorePhysicsTable(tmp.str());
+    if (ok)
+    {
+        std::ofstream out(tmp.str() + "/key.txt");
+        out << key;
+        ok = out.good();
+    }
+
+    // move into place (fails if another job was faster)
+    if (!ok || std::rename(tmp.str().c_str(), dir.c_str()))
+    {
+        if (!ok)
+            G4cout << "A2RunManager::StorePhysicsTableCache(): Could not store the physics tables in "
+                   << tmp.str() << "!" << G4endl;
+        RemoveDir(tmp.str());
+        return;
+    }
+
+    G4cout << "A2RunManager::StorePhysicsTableCache(): Stored physics tables in " << dir << G4endl;
+}
+
+//______________________________________________________________________________
+G4String A2RunManager::Hash(const G4String& s)
+{
+    // Return the 64-bit FNV-1a hash of 's' as hexadecimal string.
+
+    unsigned long long h = 14695981039346656037ULL;
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        h ^= (unsigned char)s[i];
+        h *= 1099511628211ULL;
+    }
+
+    char buf[17];
+    snprintf(buf, sizeof(buf), "%016llx", h);
+    return buf;
+}
+
+//______________________________________________________________________________
+G4bool A2RunManager::MakeDir(const G4String& dir)
+{
+    // Create the directory 'dir' including its parents. Return true if the
+    // directory exists afterwards.
+
+    for (size_t pos = dir.find('/', 1); ; pos = dir.find('/', pos+1))
+    {
+        G4String sub = dir.substr(0, pos);
+        if (mkdir(sub.c_str(), 0755) && errno != EEXIST)
+            return false;
+        if (pos == std::string::npos)
+            break;
+    }
+
+    struct stat st;
+    return !stat(dir.c_str(), &st) && S_ISDIR(st.st_mode);
+}
+
+//______________________________________________________________________________
+void A2RunManager::RemoveDir(const G4String& dir)
+{
+    // Remove the (flat) directory 'dir' and its files.
+
+    DIR* d = opendir(dir.c_str());
+    if (!d)
+        return;
+    while (struct dirent* e = readdir(d))
+    {
+        G4String name = e->d_name;
+        if (name != "." && name != "..")
+            unlink((dir + "/" + name).c_str());
+    }
+    closedir(d);
+    rmdir(dir.c_str());
+}
+
+//______________________________________________________________________________
+void A2RunManager::BeginPhase(const G4String& name)
+{
+    // Start the phase 'name' (nested in the currently running phase).
+
+    A2Phase_t phase;
+    phase.fName = name;
+    phase.fDepth = fOpen.size();
+    phase.fTime = -1;
+    phase.fStart = Clock_t::now();
+    fOpen.push_back(fPhases.size());
+    fPhases.push_back(phase);
+}
+
+//______________________________________________________________________________
+void A2RunManager::EndPhase()
+{
+    // Stop the innermost running phase.
+
+    if (fOpen.empty())
+    {
+        G4cout << "A2RunManager::EndPhase(): No running phase!" << G4endl;
+        return;
+    }
+
+    A2Phase_t& phase = fPhases[fOpen.back()];
+    phase.fTime = std::chrono::duration<G4double>(Clock_t::now() - phase.fStart).count();
+    fOpen.pop_back();
+}
+
+//______________________________________________________________________________
+void A2RunManager::PrintStartupReport()
+{
+    // Print the wall time of all phases since the program start. Phases
+    // still running (e.g. the macro containing /run/beamOn) are shown
+    // with their time so far.
+
+    fReported = true;
+
+    Clock_t::time_point now = Clock_t::now();
+    G4double total = std::chrono::duration<G4double>(now - fStart).count();
+    if (total <= 0)
+        total = 1e-9;
+
+    G4cout << G4endl
+           << "A2RunManager: startup time " << std::fixed << std::setprecision(3)
+           << total << " s" << G4endl
+           << "  phase                                     time [s]   fraction" << G4endl;
+    for (size_t i = 0; i < fPhases.size(); i++)
+    {
+        const A2Phase_t& p = fPhases[i];
+        G4bool running = p.fTime < 0;
+        G4double t = running ? std::chrono::duration<G4double>(now - p.fStart).count() : p.fTime;
+        G4String name = std::string(2*p.fDepth, ' ') + p.fName + (running ? " (running)" : "");
+        G4cout << "  " << std::left << std::setw(40) << name << std::right
+               << std::setw(10) << t
+               << std::setw(10) << std::setprecision(1) << 100.*t/total << " %"
+               << std::setprecision(3) << G4endl;
+    }
+    G4cout << std::defaultfloat << std::setprecision(6) << G4endl;
+}
+
@@ -0,0 +1,46 @@
+#include "A2RunManagerMessenger.hh"
+
+#include "A2RunManager.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithAString.hh"
+
+
+A2RunManagerMessenger::A2RunManagerMessenger(A2RunManager* runManager)
+:fRunManager(runManager)
+{
+  fCacheDir = new G4UIdirectory("/A2/cache/");
+  fCacheDir->SetGuidance("Caches shared across jobs");
+
+  fPhysicsTablesCmd = new G4UIcmdWithAString("/A2/cache/physicsTables",this);
+  fPhysicsTablesCmd->SetGuidance("Directory of the physics table cache (none to disable, default)");
+  fPhysicsTablesCmd->SetGuidance("Tables are stored per Geant4 version, physics list, cuts and materials");
+  fPhysicsTablesCmd->SetParameterName("dir",false);
+  fPhysicsTablesCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fGeometryCmd = new G4UIcmdWithAString("/A2/cache/geometry",this);
+  fGeometryCmd->SetGuidance("Directory of the geometry cache (none to disable, default)");
+  fGeometryCmd->SetGuidance("The geometry is stored as GDML per detector setup and data files (batch mode only)");
+  fGeometryCmd->SetParameterName("dir",false);
+  fGeometryCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+}
+
+
+
+A2RunManagerMessenger::~A2RunManagerMessenger()
+{
+  delete fCacheDir;
+  delete fPhysicsTablesCmd;
+  delete fGeometryCmd;
+}
+
+
+
+void A2RunManagerMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
+{
+  if( command == fPhysicsTablesCmd )
+    { fRunManager->SetPhysicsCacheDir(newValue == "none" ? G4String() : newValue);}
+
+  if( command == fGeometryCmd )
+    { fRunManager->SetGeometryCacheDir(newValue == "none" ? G4String() : newValue);}
+}
+
@@ -0,0 +1,214 @@
+// Stacking action: early kill of undetectable and late secondaries and
+// deferral of neutrons born in passive material, with kill counts per class
+// Author: Dominik Werthmueller, 2026
+
+#include <sstream>
+
+#include "G4Track.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4StackManager.hh"
+#include "G4NeutrinoE.hh"
+#include "G4AntiNeutrinoE.hh"
+#include "G4NeutrinoMu.hh"
+#include "G4AntiNeutrinoMu.hh"
+#include "G4NeutrinoTau.hh"
+#include "G4AntiNeutrinoTau.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4Neutron.hh"
+#include "CLHEP/Units/SystemOfUnits.h"
+
+#include "A2StackingAction.hh"
+#include "A2StackingActionMessenger.hh"
+
+//______________________________________________________________________________
+A2StackingAction::A2StackingAction()
+    : G4UserStackingAction()
+{
+    // Constructor.
+
+    // init members
+    fKillNeutrinos = true;
+    fKillOptical = true;
+    fMaxTime = 2*CLHEP::ms;     // same as the time cut of the stepping action
+    fDeferPassive = false;
+    fDropDeferred = false;
+    fPassiveNames.push_back("CBPassive");
+    fPassiveNames.push_back("CherenkovFrame");
+    for (G4int i = 0; i < 6; i++)
+        fNeutrinos[i] = 0;
+    fOpticalPhoton = 0;
+    fNeutron = 0;
+    fStage = 0;
+    fNSecondaries = 0;
+    fMaxDepth = 0;
+    for (G4int i = 0; i < kNClass; i++)
+        fNClass[i] = 0;
+    fMessenger = new A2StackingActionMessenger(this);
+}
+
+//______________________________________________________________________________
+A2StackingAction::~A2StackingAction()
+{
+    // Destructor.
+
+    delete fMessenger;
+}
+
+//______________________________________________________________________________
+void A2StackingAction::SetPassiveRegions(const G4String& names)
+{
+    // Set the passive regions from a list of region names.
+
+    fPassiveNames.clear();
+    std::istringstream iss(names);
+    G4String name;
+    while (iss >> name)
+        fPassiveNames.push_back(name);
+}
+
+//______________________________________________________________________________
+void A2StackingAction::BeginOfRun()
+{
+    // Cache particle and region pointers and reset the counters.
+
+    fNeutrinos[0] = G4NeutrinoE::Definition();
+    fNeutrinos[1] = G4AntiNeutrinoE::Definition();
+    fNeutrinos[2] = G4NeutrinoMu::Definition();
+    fNeutrinos[3] = G4AntiNeutrinoMu::Definition();
+    fNeutrinos[4] = G4NeutrinoTau::Definition();
+    fNeutrinos[5] = G4AntiNeutrinoTau::Definition();
+    fOpticalPhoton = G4OpticalPhoton::Definition();
+    fNeutron = G4Neutron::Definition();
+
+    fPassive.clear();
+    if (fDeferPassive)
+    {
+        for (size_t i = 0; i < fPassiveNames.size(); i++)
+        {
+            const G4Region* r = G4RegionStore::GetInstance()->GetRegion(fPassiveNames[i], false);
+            if (r)
+                fPassive.push_back(r);
+            else
+                G4cout << "A2StackingAction::BeginOfRun(): Passive region '"
+                       << fPassiveNames[i] << "' not found!" << G4endl;
+        }
+    }
+
+    for (G4int i = 0; i < kNClass; i++)
+        fNClass[i] = 0;
+}
+
+//______________________________________________________________________________
+G4bool A2StackingAction::IsPassive(const G4Region* r) const
+{
+    // Check if the region 'r' is a passive region.
+
+    for (size_t i = 0; i < fPassive.size(); i++)
+        if (fPassive[i] == r) return true;
+    return false;
+}
+
+//______________________________________________________________________________
+G4ClassificationOfNewTrack A2StackingAction::ClassifyNewTrack(const G4Track* track)
+{
+    // Classify a new track.
+
+    // event statistics: stack depth including the new track
+    G4int depth = stackManager->GetNTotalTrack() + 1;
+    if (depth > fMaxDepth)
+        fMaxDepth = depth;
+
+    // primaries are always tracked
+    if (track->GetParentID() == 0)
+        return fUrgent;
+    fNSecondaries++;
+
+    const G4ParticleDefinition* def = track->GetDefinition();
+
+    // undetectable species
+    if (fKillNeutrinos)
+    {
+        for (G4int i = 0; i < 6; i++)
+        {
+            if (def == fNeutrinos[i])
+            {
+                fNClass[kNeutrino]++;
+                return fKill;
+            }
+        }
+    }
+    if (fKillOptical && def == fOpticalPhoton)
+    {
+        fNClass[kOptical]++;
+        return fKill;
+    }
+
+    // born after the readout window
+    if (fMaxTime > 0 && track->GetGlobalTime() > fMaxTime)
+    {
+        fNClass[kLate]++;
+        return fKill;
+    }
+
+    // defer neutrons born in passive material until the urgent stack is empty
+    if (fStage == 0 && def == fNeutron && !fPassive.empty())
+    {
+        const G4VPhysicalVolume* vol = track->GetVolume();
+        if (vol && IsPassive(vol->GetLogicalVolume()->GetRegion()))
+        {
+            fNClass[kDeferred]++;
+            return fWaiting;
+        }
+    }
+
+    return fUrgent;
+}
+
+//______________________________________________________________________________
+void A2StackingAction::NewStage()
+{
+    // Called when the urgent stack is empty and the deferred tracks have been
+    // moved to it. Drop them if requested, otherwise they are tracked now.
+
+    if (fStage++ == 0 && fDropDeferred)
+    {
+        fNClass[kDropped] += stackManager->GetNUrgentTrack();
+        stackManager->clear();
+    }
+}
+
+//______________________________________________________________________________
+void A2StackingAction::PrepareNewEvent()
+{
+    // Reset the stage and the event statistics at the beginning of the event.
+
+    fStage = 0;
+    fNSecondaries = 0;
+    fMaxDepth = 0;
+}
+
+//______________________________________________________________________________
+G4String A2StackingAction::GetSummary() const
+{
+    // Return the kill counts of the run as a string.
+
+    std::ostringstream oss;
+    oss << "killed " << fNClass[kNeutrino] << " neutrinos, "
+        << fNClass[kOptical] << " optical photons, "
+        << fNClass[kLate] << " late secondaries; deferred "
+        << fNClass[kDeferred] << " passive neutrons, dropped "
+        << fNClass[kDropped];
+    return oss.str();
+}
+
+//______________________________________________________________________________
+void A2StackingAction::EndOfRun() const
+{
+    // Print the kill counts of the run.
+
+    G4cout << "A2StackingAction::EndOfRun(): " << GetSummary() << G4endl;
+}
+
@@ -0,0 +1,88 @@
+#include "A2StackingActionMessenger.hh"
+
+#include "A2StackingAction.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+
+
+A2StackingActionMessenger::A2StackingActionMessenger(A2StackingAction* stack)
+:fStacking(stack)
+{
+  fStackDir = new G4UIdirectory("/A2/stack/");
+  fStackDir->SetGuidance("Secondary classification and early kill");
+
+  fKillNeutrinosCmd = new G4UIcmdWithABool("/A2/stack/killNeutrinos",this);
+  fKillNeutrinosCmd->SetGuidance("Kill neutrinos at birth (default true)");
+  fKillNeutrinosCmd->SetParameterName("kill",true);
+  fKillNeutrinosCmd->SetDefaultValue(true);
+  fKillNeutrinosCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fKillOpticalCmd = new G4UIcmdWithABool("/A2/stack/killOptical",this);
+  fKillOpticalCmd->SetGuidance("Kill optical photons at birth (default true)");
+  fKillOpticalCmd->SetParameterName("kill",true);
+  fKillOpticalCmd->SetDefaultValue(true);
+  fKillOpticalCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fMaxTimeCmd = new G4UIcmdWithADoubleAndUnit("/A2/stack/maxTime",this);
+  fMaxTimeCmd->SetGuidance("Kill secondaries born after the readout window (0 to disable, default 2 ms)");
+  fMaxTimeCmd->SetParameterName("time",false);
+  fMaxTimeCmd->SetRange("time>=0");
+  fMaxTimeCmd->SetUnitCategory("Time");
+  fMaxTimeCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fDeferPassiveCmd = new G4UIcmdWithABool("/A2/stack/deferPassiveNeutrons",this);
+  fDeferPassiveCmd->SetGuidance("Track neutrons born in the passive regions after all other particles of the event");
+  fDeferPassiveCmd->SetParameterName("defer",true);
+  fDeferPassiveCmd->SetDefaultValue(true);
+  fDeferPassiveCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fDropDeferredCmd = new G4UIcmdWithABool("/A2/stack/dropDeferred",this);
+  fDropDeferredCmd->SetGuidance("Drop the deferred neutrons instead of tracking them");
+  fDropDeferredCmd->SetParameterName("drop",true);
+  fDropDeferredCmd->SetDefaultValue(true);
+  fDropDeferredCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fPassiveRegionsCmd = new G4UIcmdWithAString("/A2/stack/passiveRegions",this);
+  fPassiveRegionsCmd->SetGuidance("Names of the passive regions (default \"CBPassive CherenkovFrame\")");
+  fPassiveRegionsCmd->SetParameterName("regions",false);
+  fPassiveRegionsCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+}
+
+
+
+A2StackingActionMessenger::~A2StackingActionMessenger()
+{
+  delete fStackDir;
+  delete fKillNeutrinosCmd;
+  delete fKillOpticalCmd;
+  delete fMaxTimeCmd;
+  delete fDeferPassiveCmd;
+  delete fDropDeferredCmd;
+  delete fPassiveRegionsCmd;
+}
+
+
+
+void A2StackingActionMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
+{
+  if( command == fKillNeutrinosCmd )
+    { fStacking->SetKillNeutrinos(fKillNeutrinosCmd->GetNewBoolValue(newValue));}
+
+  if( command == fKillOpticalCmd )
+    { fStacking->SetKillOptical(fKillOpticalCmd->GetNewBoolValue(newValue));}
+
+  if( command == fMaxTimeCmd )
+    { fStacking->SetMaxTime(fMaxTimeCmd->GetNewDoubleValue(newValue));}
+
+  if( command == fDeferPassiveCmd )
+    { fStacking->SetDeferPassive(fDeferPassiveCmd->GetNewBoolValue(newValue));}
+
+  if( command == fDropDeferredCmd )
+    { fStacking->SetDropDeferred(fDropDeferredCmd->GetNewBoolValue(newValue));}
+
+  if( command == fPassiveRegionsCmd )
+    { fStacking->SetPassiveRegions(newValue);}
+}
+
@@ -4,11 +4,17 @@
 
 #include "A2DetectorConstruction.hh"
 #include "A2EventAction.hh"
+#include "A2Profiler.hh"
+#include "A2Bench.hh"
+#include "A2Watchdog.hh"
 
 #include "G4Track.hh"
 #include "G4Gamma.hh"
 #include "G4Proton.hh"
 #include "G4SteppingManager.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4BiasingProcessInterface.hh"
 #include "CLHEP/Units/SystemOfUnits.h"
 
 using namespace CLHEP;
@@ -22,6 +28,11 @@ A2SteppingAction::A2SteppingAction(A2DetectorConstruction* det,
 {
     detector = det;
     eventaction = evt;
+    fGamma = 0;
+    fPhot = 0;
+    fProfiler = 0;
+    fBench = 0;
+    fWatchdog = 0;
 }
 
 
@@ -31,10 +42,40 @@ A2SteppingAction::~A2SteppingAction()
 
 
 
+void A2SteppingAction::BeginOfRun(A2Profiler* prof, A2Bench* bench, A2Watchdog* watchdog)
+{
+  fProfiler = prof;
+  fBench = bench;
+  fWatchdog = watchdog;
+
+  //resolve particle and process once instead of comparing names every step
+  fGamma = G4Gamma::Gamma();
+  fPhot = 0;
+  G4ProcessVector* procs = fGamma->GetProcessManager()->GetProcessList();
+  for(G4int i=0; i<procs->size(); i++) {
+    const G4VProcess* proc = (*procs)[i];
+    //biased gammas step with the wrapper, e.g. biasWrapper(phot)
+    const G4BiasingProcessInterface* wrapper = dynamic_cast<const G4BiasingProcessInterface*>(proc);
+    if(wrapper && wrapper->GetWrappedProcess()) proc = wrapper->GetWrappedProcess();
+    if(proc->GetProcessName() == "phot") {
+      fPhot = (*procs)[i];
+      break;
+    }
+  }
+  if(!fPhot)
+    G4cout<<"A2SteppingAction::BeginOfRun phot process of gammas not found, low-energy gammas are not killed"<<G4endl;
+}
+
+
+
 void A2SteppingAction::UserSteppingAction(const G4Step* aStep)
 {
   //  return;
   G4Track* track = aStep->GetTrack();
+  if(fProfiler) fProfiler->Step(aStep);
+  if(fBench) fBench->Step();
+  if(fWatchdog) fWatchdog->Step(aStep);
+  eventaction->CountStep();
 //   G4VPhysicalVolume* volume = track->GetVolume();
   
 //   // collect energy and track length step by step
@@ -76,7 +117,7 @@ void A2SteppingAction::UserSteppingAction(const G4Step* aStep)
 
   //bug in phot process, can't get rid of gamma with energy 1.2E-5MeV
   //goes into infinite loop!
-  if(track->GetDefinition()->GetParticleName()==G4Gamma::Gamma()->GetParticleName()&&track->GetKineticEnergy()/MeV<1E-4&&fpSteppingManager->GetfCurrentProcess()->GetProcessName()==G4String("phot"))track->SetTrackStatus(fStopAndKill);
+  if(track->GetDefinition()==fGamma&&track->GetKineticEnergy()<1E-4*MeV&&fpSteppingManager->GetfCurrentProcess()==fPhot)track->SetTrackStatus(fStopAndKill);
 }
 
 
@@ -0,0 +1,151 @@
+// Tagged photon beam: energies of the tagger channels are read from a
+// tagger calibration file and sampled according to a tabulated or a
+// bremsstrahlung-like 1/E spectrum
+// Author: Dominik Werthmueller, 2026
+
+#include <fstream>
+#include <sstream>
+#include <cmath>
+
+#include "CLHEP/Units/SystemOfUnits.h"
+
+#include "A2TaggedBeam.hh"
+
+using namespace CLHEP;
+
+//______________________________________________________________________________
+A2TaggedBeam::A2TaggedBeam()
+{
+    // Constructor.
+
+    // init members
+    fTabulated = false;
+}
+
+//______________________________________________________________________________
+G4bool A2TaggedBeam::Load(const char* filename)
+{
+    // Load the tagger channels from the calibration file 'filename'.
+    // Each line contains the channel number, the central energy and the
+    // width of the channel in MeV, and optionally the relative photon
+    // intensity of the channel. Without intensities, a 1/E spectrum is
+    // assumed. Empty lines and lines starting with '#' are ignored.
+
+    std::ifstream in(filename);
+    if (!in.is_open())
+    {
+        G4cout << "A2TaggedBeam::Load(): Could not open the tagger file " << filename << "!" << G4endl;
+        return false;
+    }
+
+    // read channels
+    fFileName = filename;
+    fChannel.clear();
+    fEnergy.clear();
+    fWidth.clear();
+    std::vector<G4double> intensity;
+    std::string line;
+    G4int nLine = 0;
+    G4int nIntensity = 0;
+    while (std::getline(in, line))
+    {
+        nLine++;
+
+        // skip comments and empty lines
+        size_t pos = line.find_first_not_of(" \t\r");
+        if (pos == std::string::npos || line[pos] == '#')
+            continue;
+
+        // read channel
+        std::istringstream ls(line);
+        G4int ch;
+        G4double e, w, i;
+        if (!(ls >> ch >> e >> w) || e <= 0 || w <= 0 || e - w/2 <= 0)
+        {
+            G4cout << "A2TaggedBeam::Load(): Invalid channel in line " << nLine
+                   << " of " << filename << "!" << G4endl;
+            return false;
+        }
+        fChannel.push_back(ch);
+        fEnergy.push_back(e*MeV);
+        fWidth.push_back(w*MeV);
+        if (ls >> i)
+        {
+            intensity.push_back(i);
+            nIntensity++;
+        }
+        else
+        {
+            // bremsstrahlung 1/E spectrum integrated over the channel
+            intensity.push_back(std::log((e + w/2) / (e - w/2)));
+        }
+    }
+
+    // check intensities
+    if (nIntensity > 0 && nIntensity != (G4int)fChannel.size())
+    {
+        G4cout << "A2TaggedBeam::Load(): Intensities have to be given for all or no channels in "
+               << filename << "!" << G4endl;
+        return false;
+    }
+    fTabulated = nIntensity > 0;
+
+    // build sampler
+    if (!fSampler.Init(intensity))
+    {
+        G4cout << "A2TaggedBeam::Load(): No valid tagger channels found in " << filename << "!" << G4endl;
+        return false;
+    }
+
+    // user info
+    G4cout << "A2TaggedBeam::Load(): Read " << fChannel.size() << " tagger channels ("
+           << GetEMin()/MeV << " - " << GetEMax()/MeV << " MeV) from " << filename
+           << " using a " << (fTabulated ? "tabulated" : "1/E") << " spectrum" << G4endl;
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4double A2TaggedBeam::GetEMin() const
+{
+    // Return the lowest photon energy covered by the tagger channels.
+
+    G4double e = 0;
+    for (G4int i = 0; i < (G4int)fEnergy.size(); i++)
+        if (i == 0 || fEnergy[i] - fWidth[i]/2 < e)
+            e = fEnergy[i] - fWidth[i]/2;
+    return e;
+}
+
+//______________________________________________________________________________
+G4double A2TaggedBeam::GetEMax() const
+{
+    // Return the highest photon energy covered by the tagger channels.
+
+    G4double e = 0;
+    for (G4int i = 0; i < (G4int)fEnergy.size(); i++)
+        if (fEnergy[i] + fWidth[i]/2 > e)
+            e = fEnergy[i] + fWidth[i]/2;
+    return e;
+}
+
+//______________________________________________________________________________
+G4int A2TaggedBeam::FindChannel(G4double e) const
+{
+    // Return the tagger channel covering the photon energy 'e' (the closest
+    // one if channels overlap), or -1 if no channel covers it.
+
+    G4int ch = -1;
+    G4double dMin = 0;
+    for (G4int i = 0; i < (G4int)fEnergy.size(); i++)
+    {
+        G4double d = std::fabs(e - fEnergy[i]);
+        if (d <= fWidth[i]/2 && (ch == -1 || d < dMin))
+        {
+            ch = fChannel[i];
+            dMin = d;
+        }
+    }
+    return ch;
+}
+
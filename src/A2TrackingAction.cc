@@ -8,6 +8,8 @@
 #include "A2TrackingAction.hh"
 #include "A2UserTrackInformation.hh"
 #include "A2PrimaryGeneratorAction.hh"
+#include "A2RunAction.hh"
+#include "A2Profiler.hh"
 
 //______________________________________________________________________________
 A2TrackingAction::A2TrackingAction()
@@ -16,6 +18,8 @@ A2TrackingAction::A2TrackingAction()
 
     fPGA = (A2PrimaryGeneratorAction*)
             G4RunManager::GetRunManager()->GetUserPrimaryGeneratorAction();
+    fProfiler = ((A2RunAction*)G4RunManager::GetRunManager()->GetUserRunAction())->GetProfiler();
+    fStoreTrajectories = true;
 }
 
 //______________________________________________________________________________
@@ -30,6 +34,22 @@ void A2TrackingAction::PreUserTrackingAction(const G4Track* aTrack)
 {
     // Overwrite PreUserTrackingAction().
 
+    // profiling
+    if (fProfiler->IsEnabled())
+        fProfiler->StartTrack(aTrack->GetDefinition());
+
+    // no trajectories without visualization, overrides /tracking/storeTrajectory
+    // (checked by the tracking manager after this call)
+    if (!fStoreTrajectories)
+        fpTrackingManager->SetStoreTrajectory(0);
+
+    // dry run: kill primaries before their first step
+    if (fPGA->IsDryRun())
+    {
+        ((G4Track*)aTrack)->SetTrackStatus(fStopAndKill);
+        return;
+    }
+
     // check for secondary track
     if (aTrack->GetParentID() == 0 && aTrack->GetUserInformation() == 0)
     {
@@ -56,6 +76,11 @@ void A2TrackingAction::PostUserTrackingAction(const G4Track* aTrack)
 {
     // Overwrite PostUserTrackingAction().
 
+    // propagate the weight of biased primaries to the event weight
+    // (secondaries are not biased, see A2BiasingOperator)
+    if (aTrack->GetParentID() == 0 && aTrack->GetWeight() != 1)
+        fPGA->MultiplyEventWeight(aTrack->GetWeight());
+
     // get list of secondaries
     G4TrackVector* secondaries = fpTrackingManager->GimmeSecondaries();
 
@@ -0,0 +1,25 @@
+// User limits with kinetic energy thresholds per particle species,
+// applied by G4UserSpecialCuts in the region they are attached to
+// Author: Dominik Werthmueller, 2026
+
+#include "A2UserLimits.hh"
+
+//______________________________________________________________________________
+void A2UserLimits::SetMinEkine(const G4ParticleDefinition* def, G4double e)
+{
+    // Set the kinetic energy threshold of the particle 'def' to 'e'.
+
+    // replace existing threshold
+    for (size_t i = 0; i < fDef.size(); i++)
+    {
+        if (fDef[i] == def)
+        {
+            fDefMinEkine[i] = e;
+            return;
+        }
+    }
+
+    fDef.push_back(def);
+    fDefMinEkine.push_back(e);
+}
+
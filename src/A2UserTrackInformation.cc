@@ -5,6 +5,9 @@
 
 #include "A2UserTrackInformation.hh"
 
+G4Allocator<A2UserTrackInformation> A2UserTrackInformationAllocator;
+G4long A2UserTrackInformation::fgNCreated = 0;
+
 //______________________________________________________________________________
 A2UserTrackInformation::A2UserTrackInformation()
 {
@@ -0,0 +1,197 @@
+// Sampling of primary vertices from a measured beam-spot histogram and a
+// target density profile using alias tables
+// Author: Dominik Werthmueller, 2026
+
+#include <sstream>
+
+#include "TFile.h"
+#include "TH2.h"
+
+#include "CLHEP/Units/SystemOfUnits.h"
+#include "Randomize.hh"
+
+#include "A2VertexSampler.hh"
+
+using namespace CLHEP;
+
+//______________________________________________________________________________
+TH1* A2VertexSampler::LoadHistogram(const G4String& spec, G4int dim)
+{
+    // Load the histogram of dimension 'dim' specified by 'spec' in the
+    // format 'file.root histogram'. The returned histogram is owned by the
+    // caller.
+
+    // parse specification
+    std::istringstream in(spec);
+    G4String fileName;
+    G4String histName;
+    if (!(in >> fileName >> histName))
+    {
+        G4cout << "A2VertexSampler::LoadHistogram(): Expected 'file.root histogram' instead of '"
+               << spec << "'!" << G4endl;
+        return 0;
+    }
+
+    // open file
+    TFile* file = TFile::Open(fileName.c_str());
+    if (!file || file->IsZombie())
+    {
+        G4cout << "A2VertexSampler::LoadHistogram(): Could not open the ROOT file " << fileName << "!" << G4endl;
+        delete file;
+        return 0;
+    }
+
+    // get histogram
+    TH1* h = (TH1*)file->Get(histName.c_str());
+    if (!h || !h->InheritsFrom("TH1") || h->GetDimension() != dim)
+    {
+        G4cout << "A2VertexSampler::LoadHistogram(): " << dim << "-dim. histogram " << histName
+               << " not found in " << fileName << "!" << G4endl;
+        delete file;
+        return 0;
+    }
+    h = (TH1*)h->Clone();
+    h->SetDirectory(0);
+    delete file;
+
+    return h;
+}
+
+//______________________________________________________________________________
+G4bool A2VertexSampler::LoadBeamSpot(const G4String& spec)
+{
+    // Load the beam-spot distribution from the 2-dim. histogram specified by
+    // 'spec' ('file.root histogram', x- and y-axis in mm).
+
+    TH2* h = (TH2*)LoadHistogram(spec, 2);
+    if (!h)
+        return false;
+
+    // read bins
+    G4int nx = h->GetNbinsX();
+    G4int ny = h->GetNbinsY();
+    std::vector<G4double> weights;
+    fSpotX.clear();
+    fSpotY.clear();
+    fSpotW.clear();
+    fSpotH.clear();
+    for (G4int i = 1; i <= nx; i++)
+    {
+        for (G4int j = 1; j <= ny; j++)
+        {
+            G4double c = h->GetBinContent(i, j);
+            weights.push_back(c > 0 ? c : 0);
+            fSpotX.push_back(h->GetXaxis()->GetBinLowEdge(i)*mm);
+            fSpotY.push_back(h->GetYaxis()->GetBinLowEdge(j)*mm);
+            fSpotW.push_back(h->GetXaxis()->GetBinWidth(i)*mm);
+            fSpotH.push_back(h->GetYaxis()->GetBinWidth(j)*mm);
+        }
+    }
+    delete h;
+
+    // build alias table
+    if (!fSpot.Init(weights))
+    {
+        G4cout << "A2VertexSampler::LoadBeamSpot(): Empty beam-spot histogram!" << G4endl;
+        return false;
+    }
+
+    G4cout << "A2VertexSampler::LoadBeamSpot(): Using " << nx << "x" << ny
+           << " bins beam-spot histogram" << G4endl;
+
+    return true;
+}
+
+//______________________________________________________________________________
+G4bool A2VertexSampler::LoadTargetProfile(const G4String& spec)
+{
+    // Load the target density profile along z from the 1-dim. histogram
+    // specified by 'spec' ('file.root histogram', x-axis in mm relative to
+    // the target center).
+
+    TH1* h = LoadHistogram(spec, 1);
+    if (!h)
+        return false;
+
+    // read bins
+    G4int n = h->GetNbinsX();
+    std::vector<G4double> weights;
+    fProfileZ.clear();
+    fProfileW.clear();
+    for (G4int i = 1; i <= n; i++)
+    {
+        G4double c = h->GetBinContent(i);
+        weights.push_back(c > 0 ? c : 0);
+        fProfileZ.push_back(h->GetXaxis()->GetBinLowEdge(i)*mm);
+        fProfileW.push_back(h->GetXaxis()->GetBinWidth(i)*mm);
+    }
+    delete h;
+
+    // build alias table
+    if (!fProfile.Init(weights))
+    {
+        G4cout << "A2VertexSampler::LoadTargetProfile(): Empty target-profile histogram!" << G4endl;
+        return false;
+    }
+
+    G4cout << "A2VertexSampler::LoadTargetProfile(): Using " << n
+           << " bins target-profile histogram" << G4endl;
+
+    return true;
+}
+
+//______________________________________________________________________________
+void A2VertexSampler::SampleBeamSpot(G4double& x, G4double& y) const
+{
+    // Sample a beam position from the beam-spot histogram.
+
+    G4int b = fSpot.Sample(G4UniformRand());
+    x = fSpotX[b] + G4UniformRand()*fSpotW[b];
+    y = fSpotY[b] + G4UniformRand()*fSpotH[b];
+}
+
+//______________________________________________________________________________
+G4double A2VertexSampler::SampleTargetProfile() const
+{
+    // Sample a z-position relative to the target center from the target
+    // profile.
+
+    G4int b = fProfile.Sample(G4UniformRand());
+    return fProfileZ[b] + G4UniformRand()*fProfileW[b];
+}
+
+//______________________________________________________________________________
+G4ThreeVector A2VertexSampler::SampleCylinder(G4double t_length, G4double t_center,
+                                              G4double b_diam) const
+{
+    // Sample a vertex using the beam-spot histogram and target profile if
+    // they were loaded, otherwise within the target-beam cylinder as
+    // A2FileGenerator::GenerateVertexCylinder().
+
+    // transverse position
+    G4double vX = 1e10;
+    G4double vY = 1e10;
+    if (HasBeamSpot())
+    {
+        SampleBeamSpot(vX, vY);
+    }
+    else
+    {
+        G4double beamRad = b_diam / 2.;
+        while (vX*vX+vY*vY > beamRad*beamRad)
+        {
+            vX = beamRad * (2. * G4UniformRand() - 1.);
+            vY = beamRad * (2. * G4UniformRand() - 1.);
+        }
+    }
+
+    // longitudinal position
+    G4double vZ;
+    if (HasTargetProfile())
+        vZ = t_center + SampleTargetProfile();
+    else
+        vZ = t_length / 2. * (2. * G4UniformRand() - 1.) + t_center;
+
+    return G4ThreeVector(vX, vY, vZ);
+}
+
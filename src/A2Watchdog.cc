@@ -0,0 +1,192 @@
+// Watchdog of runaway events: per-event step and wall-time budgets,
+// clean abort and a trace of the steps that exceeded the budget
+// Author: Dominik Werthmueller, 2026
+
+#include <string>
+
+#include "G4Event.hh"
+#include "G4Track.hh"
+#include "G4VProcess.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4RunManager.hh"
+#include "CLHEP/Units/SystemOfUnits.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TString.h"
+
+#include "A2Watchdog.hh"
+#include "A2WatchdogMessenger.hh"
+
+//______________________________________________________________________________
+A2Watchdog::A2Watchdog()
+{
+    // Constructor.
+
+    // init members
+    fMaxSteps = 0;
+    fMaxTime = 0;
+    fTraceSize = 20;
+    fEventID = -1;
+    fSteps = 0;
+    fTime = 0;
+    fNTraced = 0;
+    fMessenger = new A2WatchdogMessenger(this);
+}
+
+//______________________________________________________________________________
+A2Watchdog::~A2Watchdog()
+{
+    // Destructor.
+
+    delete fMessenger;
+}
+
+//______________________________________________________________________________
+void A2Watchdog::BeginOfRun()
+{
+    // Clear the records and keep the random engine status of every event
+    // in the event so that aborted events can be reproduced.
+
+    fRecords.clear();
+    G4RunManager* rm = G4RunManager::GetRunManager();
+    rm->StoreRandomNumberStatusToG4Event(rm->GetFlagRandomNumberStatusToG4Event() | 1);
+}
+
+//______________________________________________________________________________
+void A2Watchdog::BeginOfEvent(const G4Event* evt)
+{
+    // Reset the budgets of the event.
+
+    fEventID = evt->GetEventID();
+    fSteps = 0;
+    fReason = "";
+    fTime = 0;
+    fNTraced = 0;
+    fTrace = "";
+    fStart = Clock_t::now();
+}
+
+//______________________________________________________________________________
+void A2Watchdog::Exceeded(const char* reason)
+{
+    // Start the abort of the current event after the budget 'reason' was
+    // exceeded.
+
+    fReason = reason;
+    fTime = std::chrono::duration<G4double>(Clock_t::now() - fStart).count();
+
+    G4cout << "A2Watchdog::Exceeded(): Event " << fEventID << " exceeded the "
+           << fReason << " budget after " << fSteps << " steps and "
+           << fTime << " s, aborting after tracing " << fTraceSize << " steps" << G4endl;
+
+    if (fTraceSize <= 0)
+        G4RunManager::GetRunManager()->AbortEvent();
+}
+
+//______________________________________________________________________________
+void A2Watchdog::TraceStep(const G4Step* step)
+{
+    // Add the step 'step' to the trace and abort the event once the trace
+    // is complete.
+
+    if (fNTraced >= fTraceSize)
+        return;
+
+    const G4Track* track = step->GetTrack();
+    const G4StepPoint* post = step->GetPostStepPoint();
+    const G4VProcess* proc = post->GetProcessDefinedStep();
+    const G4VPhysicalVolume* vol = step->GetPreStepPoint()->GetPhysicalVolume();
+    G4ThreeVector pos = post->GetPosition();
+
+    fTrace += TString::Format("trk %d (parent %d) %s in %s by %s: Ekin=%g MeV pos=(%.4g,%.4g,%.4g) mm len=%g mm\n",
+                              track->GetTrackID(), track->GetParentID(),
+                              track->GetDefinition()->GetParticleName().c_str(),
+                              vol ? vol->GetName().c_str() : "none",
+                              proc ? proc->GetProcessName().c_str() : "none",
+                              track->GetKineticEnergy() / CLHEP::MeV,
+                              pos.x() / CLHEP::mm, pos.y() / CLHEP::mm, pos.z() / CLHEP::mm,
+                              step->GetStepLength() / CLHEP::mm).Data();
+
+    if (++fNTraced == fTraceSize)
+        G4RunManager::GetRunManager()->AbortEvent();
+}
+
+//______________________________________________________________________________
+void A2Watchdog::EndOfEvent(const G4Event* evt, G4int inputEntry)
+{
+    // Record the event 'evt' with the input entry 'inputEntry' if it was
+    // aborted by the watchdog.
+
+    if (fReason.empty())
+        return;
+
+    // event ended before the trace was complete
+    if (!evt->IsAborted())
+    {
+        G4cout << "A2Watchdog::EndOfEvent(): Event " << evt->GetEventID()
+               << " finished while being traced, not aborted" << G4endl;
+        fReason = "";
+        return;
+    }
+
+    A2WatchdogRecord_t rec;
+    rec.fEventID = evt->GetEventID();
+    rec.fInputEntry = inputEntry;
+    rec.fReason = fReason;
+    rec.fSteps = fSteps;
+    rec.fTime = fTime;
+    rec.fRndmStatus = evt->GetRandomNumberStatus();
+    rec.fTrace = fTrace;
+    fRecords.push_back(rec);
+
+    G4cout << "A2Watchdog::EndOfEvent(): Aborted event " << rec.fEventID
+           << " (input entry " << rec.fInputEntry << "), last steps:" << G4endl
+           << rec.fTrace
+           << "Random engine status at the begin of the event:" << G4endl
+           << rec.fRndmStatus << G4endl;
+
+    fReason = "";
+}
+
+//______________________________________________________________________________
+void A2Watchdog::WriteTree(TFile* f) const
+{
+    // Write the aborted events to the tree 'A2Watchdog' in the file 'f'.
+
+    if (!f || fRecords.empty())
+        return;
+
+    Int_t event;
+    Int_t entry;
+    Long64_t steps;
+    Double_t time;
+    std::string reason;
+    std::string rndm;
+    std::string trace;
+
+    f->cd();
+    TTree* tree = new TTree("A2Watchdog", "Events aborted by the watchdog");
+    tree->Branch("event", &event, "event/I");
+    tree->Branch("entry", &entry, "entry/I");
+    tree->Branch("steps", &steps, "steps/L");
+    tree->Branch("time", &time, "time/D");
+    tree->Branch("reason", &reason);
+    tree->Branch("rndm", &rndm);
+    tree->Branch("trace", &trace);
+
+    for (size_t i = 0; i < fRecords.size(); i++)
+    {
+        event = fRecords[i].fEventID;
+        entry = fRecords[i].fInputEntry;
+        steps = fRecords[i].fSteps;
+        time = fRecords[i].fTime;
+        reason = fRecords[i].fReason;
+        rndm = fRecords[i].fRndmStatus;
+        trace = fRecords[i].fTrace;
+        tree->Fill();
+    }
+
+    tree->Write();
+    delete tree;
+}
+
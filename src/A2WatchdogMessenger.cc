@@ -0,0 +1,60 @@
+#include "A2WatchdogMessenger.hh"
+
+#include "A2Watchdog.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "CLHEP/Units/SystemOfUnits.h"
+
+
+A2WatchdogMessenger::A2WatchdogMessenger(A2Watchdog* watchdog)
+:fWatchdog(watchdog)
+{
+  fWatchdogDir = new G4UIdirectory("/A2/watchdog/");
+  fWatchdogDir->SetGuidance("Per-event step and wall-time budgets");
+
+  fMaxStepsCmd = new G4UIcmdWithAnInteger("/A2/watchdog/maxSteps",this);
+  fMaxStepsCmd->SetGuidance("Abort events with more steps (0 to disable, default 0)");
+  fMaxStepsCmd->SetParameterName("n",false);
+  fMaxStepsCmd->SetRange("n>=0");
+  fMaxStepsCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fMaxTimeCmd = new G4UIcmdWithADoubleAndUnit("/A2/watchdog/maxTime",this);
+  fMaxTimeCmd->SetGuidance("Abort events with a longer wall time (0 to disable, default 0)");
+  fMaxTimeCmd->SetParameterName("time",false);
+  fMaxTimeCmd->SetRange("time>=0");
+  fMaxTimeCmd->SetUnitCategory("Time");
+  fMaxTimeCmd->SetDefaultUnit("s");
+  fMaxTimeCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  fTraceSizeCmd = new G4UIcmdWithAnInteger("/A2/watchdog/traceSize",this);
+  fTraceSizeCmd->SetGuidance("Number of steps traced before an event is aborted (default 20)");
+  fTraceSizeCmd->SetParameterName("n",false);
+  fTraceSizeCmd->SetRange("n>=0");
+  fTraceSizeCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+}
+
+
+
+A2WatchdogMessenger::~A2WatchdogMessenger()
+{
+  delete fWatchdogDir;
+  delete fMaxStepsCmd;
+  delete fMaxTimeCmd;
+  delete fTraceSizeCmd;
+}
+
+
+
+void A2WatchdogMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
+{
+  if( command == fMaxStepsCmd )
+    { fWatchdog->SetMaxSteps(fMaxStepsCmd->GetNewIntValue(newValue));}
+
+  if( command == fMaxTimeCmd )
+    { fWatchdog->SetMaxTime(fMaxTimeCmd->GetNewDoubleValue(newValue)/CLHEP::s);}
+
+  if( command == fTraceSizeCmd )
+    { fWatchdog->SetTraceSize(fTraceSizeCmd->GetNewIntValue(newValue));}
+}
+